@@ -5,7 +5,11 @@
  * Author: Miguel Osuna
  */ 
 
-#include "adc.h"
+#include "ADC.h"
+
+#if ADC_SLEEP_WAIT
+#include "Wait.h"
+#endif
 
 /*
  * //////////////////////////////////////////////////////////////////////////
@@ -77,10 +81,14 @@ static inline void set_prescaler(uint8_t prescaler)
 	// (ADCSRA): ADC Control and Status Register A
 	// (ADPSn): ADC Prescaler Select [n = 2:0]
 	
-	if(prescaler != 2 || prescaler != 4 || prescaler != 8 || prescaler != 16 || prescaler != 32 || prescaler != 64 || prescaler != 128)
+	uint8_t adps = 1;	// '1': clk/2 ... '7': clk/128, powers of two
+
+	if(prescaler < 2 || (prescaler & (prescaler - 1)))
 		prescaler = 128;
+	while((1 << adps) < prescaler)
+		adps++;
 
-	ADCSRA |= (prescaler << ADPS0);
+	ADCSRA = (ADCSRA & ~((1 << ADPS2) | (1 << ADPS1) | (1 << ADPS0))) | (adps << ADPS0);
 }
 
 /* 
@@ -118,8 +126,16 @@ static inline uint16_t single_conversion_adc()
 	// (ADSC): ADC Start Conversion)
 	
 	uint16_t adc_reading;			// ADC reading variable
+#if ADC_SLEEP_WAIT
+	// (ADIE): ADC Interrupt Enable, off again in the ISR. Writing it with
+	// ADSC also clears a stale ADIF, which would wake the CPU too early
+	ADCSRA |= (1 << ADIE) | (1 << ADSC);
+	WAIT_UNTIL((ADC_SLEEP_WAIT == ADC_SLEEP_NOISE_REDUCTION) ? SLEEP_MODE_ADC : SLEEP_MODE_IDLE,
+		!(ADCSRA & (1 << ADSC)));
+#else
 	ADCSRA |= (1 << ADSC);			// Start Conversion
-	while(!(ADCSRA & (1 << ADSC))); // Wait until done
+	while(ADCSRA & (1 << ADSC));	// Wait until done (ADSC reads '1' while converting)
+#endif
 	adc_reading = ADC;				// Read ADC in
 	
 	// Left Adjust Result. Therefore, only High Register Needed
@@ -161,7 +177,7 @@ uint16_t read_adc(uint8_t channel)
 	set_channel(channel);
 	
 	// Free Running Mode Conversion
-	if(!(ADCSRB & ((1 << ADTS2) | (1 << ADTS1) | (1 << ADPS0)))) // Check for free running mode
+	if(ADCSRA & (1 << ADATE))	// Auto Trigger is only enabled for free running mode
 		adc_reading = free_running_adc();
 		
 	// Single Mode Conversion
@@ -169,4 +185,17 @@ uint16_t read_adc(uint8_t channel)
 		adc_reading = single_conversion_adc();
 
 	return adc_reading;
-}			
\ No newline at end of file
+}
+
+#if ADC_SLEEP_WAIT
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							ADC Interrupts
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// ADIF is cleared by the vector, the ISR only turns ADIE off again
+ISR(ADC_vect)
+{
+	ADCSRA &= ~(1 << ADIE);
+}
+#endif
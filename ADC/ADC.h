@@ -48,21 +48,27 @@ extern "C" {
 #define ADC_REFERENCE_ACC 1
 #define ADC_REFERENCE_INTERNAL 3
 
-#define ADC_SINGLE_MODE 0
-#define ADC_RUNNING_MODE 1
+#define ADC_SINGLE_MODE 1
+#define ADC_RUNNING_MODE 0
+
+// Set ADC_SLEEP_WAIT project-wide to sleep through single conversions
+// instead of polling ADSC. ADC.c then owns ADC_vect, which only wakes the
+// CPU. Noise reduction also halts clkIO: Timer 0/1 (millis()) and the
+// USART pause for the ~13 ADC clocks of each conversion.
+#define ADC_SLEEP_OFF 0
+#define ADC_SLEEP_IDLE 1
+#define ADC_SLEEP_NOISE_REDUCTION 2
+
+#ifndef ADC_SLEEP_WAIT
+#define ADC_SLEEP_WAIT ADC_SLEEP_OFF
+#endif
 
 /*
  * //////////////////////////////////////////////////////////////////////////
  *							ADC Functions
  * //////////////////////////////////////////////////////////////////////////
  */ 
-static inline void set_reference(uint8_t ref);
-static inline void set_adjust(uint8_t adjust);
-static inline void set_channel(uint8_t channel);
-static inline void set_prescaler(uint8_t prescaler);
 void init_adc(uint8_t prescaler, uint8_t adjust, uint8_t ref, uint8_t mode);
-static inline uint16_t single_conversion_adc();
-static inline uint16_t free_running_adc();
 uint16_t read_adc(uint8_t channel);
 
 #ifdef __cplusplus
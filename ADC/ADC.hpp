@@ -0,0 +1,117 @@
+/*
+ * adc.hpp
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _ADC_HPP_
+#define _ADC_HPP_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include "ADC.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							ADC Template Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Header-only C++ (-std=gnu++11) front end for single conversions, next to
+ * the C API. Reference and prescaler are template arguments taken from the
+ * ADC_REFERENCE_n / ADC_PRESCALER_n constants, so ADMUX and ADCSRA are
+ * constants and an invalid or out-of-range setting fails the build:
+ *	typedef Adc<ADC_REFERENCE_ACC, ADC_PRESCALER_128> Analog;
+ *	Analog::init();
+ *	uint16_t level = Analog::read<ADC_CHANNEL_3>();
+ */
+// The ADC clock has to stay within 50 kHz - 200 kHz for full 10-bit
+// resolution, ADC_MAX_CLOCK_HZ may be raised up to 1 MHz for fewer bits
+#ifndef ADC_MAX_CLOCK_HZ
+#define ADC_MAX_CLOCK_HZ 200000UL
+#endif
+
+#define ADC_CHANNEL_BANDGAP 14
+#define ADC_CHANNEL_GND 15
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							ADC Class
+ * //////////////////////////////////////////////////////////////////////////
+ */
+template<uint8_t Ref, uint8_t Prescaler>
+class Adc
+{
+	static_assert(Ref == ADC_REFERENCE_AREF || Ref == ADC_REFERENCE_ACC || Ref == ADC_REFERENCE_INTERNAL,
+		"Adc: reference must be ADC_REFERENCE_AREF, ADC_REFERENCE_ACC or ADC_REFERENCE_INTERNAL");
+	static_assert(Prescaler >= 2 && (Prescaler & (Prescaler - 1)) == 0,
+		"Adc: prescaler must be one of ADC_PRESCALER_2 ... ADC_PRESCALER_128");
+	static_assert(F_CPU / Prescaler >= 50000UL && F_CPU / Prescaler <= ADC_MAX_CLOCK_HZ,
+		"Adc: ADC clock (F_CPU / prescaler) out of range");
+
+	// (ADPS2:0): ADC Prescaler Select, log2 of the division factor
+	static constexpr uint8_t adps(uint8_t div)
+	{
+		return (div <= 2) ? 1 : (uint8_t) (1 + adps((uint8_t) (div >> 1)));
+	}
+
+	// (ADMUX): (REFSn) Reference Selection
+	static constexpr uint8_t admux = (uint8_t) (Ref << REFS0);
+
+	static void convert()
+	{
+		// (ADSC): ADC Start Conversion, reads '1' while converting
+		ADCSRA |= (1 << ADSC);
+		while(ADCSRA & (1 << ADSC));
+	}
+
+public:
+	/* Enable the ADC for Single Conversions */
+	static void init()
+	{
+		ADMUX = admux;
+		// (ADCSRA): (ADEN) ADC Enable and the prescaler, no auto trigger
+		ADCSRA = (uint8_t) ((1 << ADEN) | (adps(Prescaler) << ADPS0));
+	}
+
+	/* Disable the ADC */
+	static void stop()
+	{
+		ADCSRA = 0;
+	}
+
+	/* 10-bit Conversion of a Channel known at Compile Time */
+	template<uint8_t Channel>
+	static uint16_t read()
+	{
+		static_assert(Channel <= 8 || Channel == ADC_CHANNEL_BANDGAP || Channel == ADC_CHANNEL_GND,
+			"Adc: no such channel");
+		ADMUX = (uint8_t) (admux | Channel);
+		convert();
+		return ADC;
+	}
+
+	/* 10-bit Conversion of a Channel chosen at Runtime */
+	static uint16_t read(uint8_t channel)
+	{
+		ADMUX = (uint8_t) (admux | (channel & 0x0F));
+		convert();
+		return ADC;
+	}
+
+	/* 8-bit Conversion, left adjusted so only ADCH is read */
+	template<uint8_t Channel>
+	static uint8_t read8()
+	{
+		static_assert(Channel <= 8 || Channel == ADC_CHANNEL_BANDGAP || Channel == ADC_CHANNEL_GND,
+			"Adc: no such channel");
+		// (ADLAR): ADC Left Adjust Result
+		ADMUX = (uint8_t) (admux | (1 << ADLAR) | Channel);
+		convert();
+		return ADCH;
+	}
+};
+
+#endif /* _ADC_HPP_ */
@@ -0,0 +1,100 @@
+/*
+ * bench.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <avr/sleep.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Bench Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Markers read by the simavr runner (runner.c). A measurement is named
+ * through GPIOR2 and bracketed by two GPIOR0 writes; the runner stamps the
+ * simulator cycle counter at each and tracks the lowest stack pointer in
+ * between, so no timer or USART of the target is used to measure.
+ *	BENCH(name, code)			Cycles and stack of one run of code
+ *	BENCH_ISR(name, vector)		Same for an ISR, called as a function
+ *
+ * BENCH_ISR() adds CALL + RET of the caller instead of the 4 cycle hardware
+ * entry and vector JMP, within 3 cycles of the real path. The ISR returns
+ * with RETI, so interrupts are disabled again right after it.
+ */
+// (GPIOR0): Marker register
+#define BENCH_MARK GPIOR0
+#define BENCH_MARK_BEGIN 1
+#define BENCH_MARK_END 2
+#define BENCH_MARK_DONE 0xFF
+
+// (GPIOR2): Name register, one character per write, '\0' terminated
+#define BENCH_NAME GPIOR2
+
+// Keeps the compiler from moving code across a marker
+#define BENCH_BARRIER() __asm__ __volatile__("" ::: "memory")
+
+#define BENCH(name, code) do { \
+	bench_name(PSTR(name)); \
+	BENCH_BARRIER(); \
+	BENCH_MARK = BENCH_MARK_BEGIN; \
+	code; \
+	BENCH_BARRIER(); \
+	BENCH_MARK = BENCH_MARK_END; \
+} while(0)
+
+#define BENCH_ISR(name, vector) do { \
+	extern void vector(void); \
+	BENCH(name, vector()); \
+	cli(); \
+} while(0)
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Bench Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */
+// Results are stored here so the measured calls are not optimized out
+static volatile uint32_t g_bench_sink;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Bench Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+static inline void bench_name(const char *name)
+{
+	char c;
+	while((c = pgm_read_byte(name++)))
+		BENCH_NAME = c;
+	BENCH_NAME = '\0';
+}
+
+/* Unnamed empty measurement, the runner subtracts it from every result */
+static inline void bench_init()
+{
+	BENCH("", );
+}
+
+/* Tells the runner the program is over and parks the CPU */
+static inline void bench_done()
+{
+	BENCH_MARK = BENCH_MARK_DONE;
+	cli();
+	sleep_enable();
+	while(1)
+		sleep_cpu();
+}
+
+#endif /* _BENCH_H_ */
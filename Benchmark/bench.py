@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+#
+# bench.py
+#
+# Created: 10/18/2026
+# Author: Miguel Osuna
+#
+# Builds and runs the simavr benchmarks and compares reports.
+#	bench.py report [--levels O1 O2 O3 Os] [--output report.csv]
+#	bench.py compare old.csv new.csv [--threshold 2]
+#
+# A report is a CSV of (level, bench, item, metric, value) rows:
+#	cycles	CPU cycles of one BENCH() measurement, marker overhead removed
+#	stack	Stack bytes used by that measurement
+#	flash	Bytes of a function (symbol size), or of the whole program
+#	sram	Static RAM (.data + .bss) of the whole program
+# Every metric is "lower is better", compare flags increases above the
+# threshold (percent) and exits with status 1 if there are any.
+#
+
+import argparse
+import csv
+import glob
+import os
+import subprocess
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+PROGRAM = "(program)"
+FIELDS = ["level", "bench", "item", "metric", "value"]
+
+# ATmega328P vector numbers, so ISRs read by name in the report
+VECTORS = [
+	"RESET", "INT0", "INT1", "PCINT0", "PCINT1", "PCINT2", "WDT",
+	"TIMER2_COMPA", "TIMER2_COMPB", "TIMER2_OVF", "TIMER1_CAPT",
+	"TIMER1_COMPA", "TIMER1_COMPB", "TIMER1_OVF", "TIMER0_COMPA",
+	"TIMER0_COMPB", "TIMER0_OVF", "SPI_STC", "USART_RX", "USART_UDRE",
+	"USART_TX", "ADC", "EE_READY", "ANALOG_COMP", "TWI", "SPM_READY",
+]
+
+
+def symbol_name(name):
+	if name.startswith("__vector_"):
+		number = int(name[len("__vector_"):])
+		if number < len(VECTORS):
+			return VECTORS[number] + "_vect"
+	return name
+
+
+def run(command):
+	return subprocess.run(command, cwd=HERE, check=True, stdout=subprocess.PIPE,
+		universal_newlines=True).stdout
+
+
+def measure(level, elf):
+	bench = os.path.basename(elf)[len("bench_"):-len(".elf")]
+	rows = []
+
+	for line in run([os.path.join("build", "runner"), elf]).splitlines():
+		item, cycles, stack = line.split("\t")
+		rows.append((level, bench, item, "cycles", int(cycles)))
+		rows.append((level, bench, item, "stack", int(stack)))
+
+	sections = {}
+	for line in run(["avr-size", "-A", elf]).splitlines():
+		fields = line.split()
+		if len(fields) >= 2 and fields[0].startswith(".") and fields[1].isdigit():
+			sections[fields[0]] = int(fields[1])
+	text = sections.get(".text", 0)
+	data = sections.get(".data", 0)
+	bss = sections.get(".bss", 0) + sections.get(".noinit", 0)
+	rows.append((level, bench, PROGRAM, "flash", text + data))
+	rows.append((level, bench, PROGRAM, "sram", data + bss))
+
+	for line in run(["avr-nm", "--size-sort", "-S", elf]).splitlines():
+		fields = line.split()
+		if len(fields) == 4 and fields[2] in "Tt":
+			rows.append((level, bench, symbol_name(fields[3]), "flash", int(fields[1], 16)))
+
+	return rows
+
+
+def report(args):
+	rows = []
+	for level in args.levels:
+		run(["make", "--no-print-directory", "OPT=" + level])
+		for elf in sorted(glob.glob(os.path.join(HERE, "build", level, "bench_*.elf"))):
+			rows.extend(measure(level, elf))
+
+	with open(args.output, "w", newline="") as f:
+		writer = csv.writer(f)
+		writer.writerow(FIELDS)
+		writer.writerows(rows)
+
+	# Cycles side by side per level, for reading on the console
+	cycles = {}
+	for level, bench, item, metric, value in rows:
+		if metric == "cycles":
+			cycles.setdefault((bench, item), {})[level] = value
+	print("%-12s %-36s" % ("bench", "item") + "".join("%9s" % level for level in args.levels))
+	for (bench, item), values in cycles.items():
+		print("%-12s %-36s" % (bench, item) + "".join("%9s" % values.get(level, "-") for level in args.levels))
+	print("%d rows written to %s" % (len(rows), args.output))
+	return 0
+
+
+def load(path):
+	with open(path, newline="") as f:
+		return {(r["level"], r["bench"], r["item"], r["metric"]): int(r["value"]) for r in csv.DictReader(f)}
+
+
+def compare(args):
+	old = load(args.old)
+	new = load(args.new)
+	regressions = 0
+
+	for key in sorted(set(old) | set(new)):
+		before = old.get(key)
+		after = new.get(key)
+		if before == after:
+			continue
+
+		label = "%-4s %-12s %-36s %-6s" % key
+		if before is None:
+			print("%s %10s -> %-8d (new)" % (label, "-", after))
+			continue
+		if after is None:
+			print("%s %10d -> %-8s (removed)" % (label, before, "-"))
+			continue
+
+		change = 100.0 * (after - before) / before if before else float("inf")
+		regression = after > before and change > args.threshold
+		regressions += regression
+		print("%s %10d -> %-8d %+7.1f %%%s" % (label, before, after, change, "  REGRESSION" if regression else ""))
+
+	print("%d regression(s) above %g %%" % (regressions, args.threshold))
+	return 1 if regressions else 0
+
+
+def main():
+	parser = argparse.ArgumentParser(description="simavr cycle, flash and SRAM benchmarks")
+	commands = parser.add_subparsers(dest="command")
+	commands.required = True
+
+	parser_report = commands.add_parser("report", help="build, run and write a report")
+	parser_report.add_argument("--levels", nargs="+", default=["O1", "O2", "O3", "Os"])
+	parser_report.add_argument("--output", default="report.csv")
+	parser_report.set_defaults(handler=report)
+
+	parser_compare = commands.add_parser("compare", help="compare two reports")
+	parser_compare.add_argument("old")
+	parser_compare.add_argument("new")
+	parser_compare.add_argument("--threshold", type=float, default=2.0)
+	parser_compare.set_defaults(handler=compare)
+
+	args = parser.parse_args()
+	return args.handler(args)
+
+
+if __name__ == "__main__":
+	sys.exit(main())
@@ -0,0 +1,23 @@
+/*
+ * bench_adc.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "ADC.h"
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_adc", init_adc(ADC_PRESCALER_128, ADC_ADJUST_RIGHT, ADC_REFERENCE_ACC, ADC_SINGLE_MODE));
+
+	// First conversion after enabling takes 25 ADC clocks, later ones 13
+	BENCH("read_adc (first)", g_bench_sink = read_adc(ADC_CHANNEL_0));
+	BENCH("read_adc", g_bench_sink = read_adc(ADC_CHANNEL_0));
+	BENCH("read_adc (channel switch)", g_bench_sink = read_adc(ADC_CHANNEL_5));
+
+	bench_done();
+}
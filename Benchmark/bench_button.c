@@ -0,0 +1,37 @@
+/*
+ * bench_button.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Button.h"
+
+int main()
+{
+	uint8_t id;
+	uint8_t event;
+
+	bench_init();
+	init_debounce(DEBOUNCE_PORT_D, 0xFF);
+	init_debounce(DEBOUNCE_PORT_C, 0x7F);
+
+	BENCH("button_add", g_bench_sink = button_add(DEBOUNCE_PORT_D, PD4));
+	for(uint8_t pin = PD5; pin < PD5 + BUTTON_MAX - 1; pin++)
+		button_add(DEBOUNCE_PORT_C, pin - PD5);
+	BENCH("button_tick (idle)", button_tick(0));
+
+	// Hold PD4 low long enough to queue a press and a long press
+	PORTD &= ~(1 << PORTD4);
+	for(uint16_t i = 0; i < BUTTON_LONG_MS + 16; i++)
+	{
+		debounce_tick(0);
+		button_tick(0);
+	}
+	BENCH("button_tick (held)", button_tick(0));
+	BENCH("button_read", g_bench_sink = button_read(&id, &event));
+	BENCH("button_read (empty)", while(button_read(&id, &event)); g_bench_sink = id);
+
+	bench_done();
+}
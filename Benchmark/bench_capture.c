@@ -0,0 +1,31 @@
+/*
+ * bench_capture.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Capture.h"
+#include "TIMER.h"
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_capture", init_capture(TIMER1_PRESCALER_8, CAPTURE_MODE_DUTY, CAPTURE_EDGE_RISING, 4));
+	cli();
+
+	BENCH_ISR("TIMER1_CAPT (first edge)", TIMER1_CAPT_vect);
+	BENCH_ISR("TIMER1_CAPT (second edge)", TIMER1_CAPT_vect);
+	BENCH_ISR("TIMER1_OVF", TIMER1_OVF_vect);
+
+	BENCH("capture_available", g_bench_sink = capture_available());
+	BENCH("capture_period", g_bench_sink = capture_period());
+	BENCH("capture_period_us", g_bench_sink = capture_period_us());
+	BENCH("capture_frequency_centihz", g_bench_sink = capture_frequency_centihz());
+	BENCH("capture_duty_permille", g_bench_sink = capture_duty_permille());
+	BENCH("stop_capture", stop_capture());
+
+	bench_done();
+}
@@ -0,0 +1,27 @@
+/*
+ * bench_critical.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include <util/atomic.h>
+
+#include "bench.h"
+#include "Critical.h"
+
+int main()
+{
+	critical_t sreg;
+
+	bench_init();
+	sei();
+
+	BENCH("critical_enter/exit", sreg = critical_enter(); critical_exit(sreg));
+	BENCH("CRITICAL_BLOCK", CRITICAL_BLOCK() { g_bench_sink++; });
+	BENCH("CRITICAL_BLOCK (nested)", CRITICAL_BLOCK() { CRITICAL_BLOCK() { g_bench_sink++; } });
+	BENCH("ATOMIC_BLOCK", ATOMIC_BLOCK(ATOMIC_RESTORESTATE) { g_bench_sink++; });
+	BENCH("critical_sei", critical_sei());
+
+	bench_done();
+}
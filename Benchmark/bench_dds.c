@@ -0,0 +1,29 @@
+/*
+ * bench_dds.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "DDS.h"
+#include "TIMER.h"
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_dds", init_dds(PWM_CHANNEL_A | PWM_CHANNEL_B));
+	cli();
+
+	BENCH("dds_set_wave", dds_set_wave(DDS_CHANNEL_A, DDS_WAVE_TRIANGLE));
+	BENCH("dds_set_frequency", dds_set_frequency(DDS_CHANNEL_A, 44000));
+	BENCH("dds_set_tuning", dds_set_tuning(DDS_CHANNEL_B, DDS_TUNING_CENTIHZ(100000)));
+	BENCH("dds_set_amplitude", dds_set_amplitude(DDS_CHANNEL_B, 128));
+	BENCH("dds_set_phase", dds_set_phase(DDS_CHANNEL_B, 64));
+
+	// Runs once per output sample, the budget is 256 cycles at clk/1
+	BENCH_ISR("TIMER2_OVF (sample)", TIMER2_OVF_vect);
+
+	bench_done();
+}
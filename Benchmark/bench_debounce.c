@@ -0,0 +1,28 @@
+/*
+ * bench_debounce.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Debounce.h"
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_debounce", init_debounce(DEBOUNCE_PORT_D, 0xF0));
+	BENCH("debounce_tick", debounce_tick(0));
+
+	// Release the pull-ups so every watched pin reads low (pressed)
+	PORTD &= 0x0F;
+	for(uint8_t i = 0; i < 8; i++)
+		debounce_tick(0);
+	BENCH("debounce_tick (settled)", debounce_tick(0));
+	BENCH("debounce_state", g_bench_sink = debounce_state(DEBOUNCE_PORT_D));
+	BENCH("debounce_pressed", g_bench_sink = debounce_pressed(DEBOUNCE_PORT_D));
+	BENCH("debounce_released", g_bench_sink = debounce_released(DEBOUNCE_PORT_D));
+
+	bench_done();
+}
@@ -0,0 +1,35 @@
+/*
+ * bench_encoder.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Encoder.h"
+#include "Millis.h"
+
+int main()
+{
+	uint8_t id;
+
+	bench_init();
+	init_millis();
+	cli();
+
+	BENCH("encoder_attach_int", id = encoder_attach_int(ENCODER_MODE_X4));
+	cli();
+
+	// Drive channel A (PD2) through its output latch, one count per edge
+	DDRD |= (1 << DDD2);
+	PIND = (1 << PIND2);
+	BENCH_ISR("INT0 (count)", INT0_vect);
+	BENCH_ISR("INT0 (no change)", INT0_vect);
+
+	BENCH("encoder_position", g_bench_sink = encoder_position(id));
+	BENCH("encoder_velocity", g_bench_sink = encoder_velocity(id));
+	BENCH("encoder_set_position", encoder_set_position(id, 0));
+	BENCH("encoder_errors", g_bench_sink = encoder_errors(id));
+
+	bench_done();
+}
@@ -0,0 +1,29 @@
+/*
+ * bench_event.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Event.h"
+
+static void bench_handler(uint8_t arg, void *ctx)
+{
+}
+
+int main()
+{
+	bench_init();
+
+	BENCH("event_post", g_bench_sink = event_post(bench_handler, 0, 0));
+	BENCH("event_pending", g_bench_sink = event_pending());
+	BENCH("event_dispatch (1 event)", g_bench_sink = event_dispatch());
+	BENCH("event_dispatch (empty)", g_bench_sink = event_dispatch());
+
+	for(uint8_t i = 0; i < 8; i++)
+		event_post(bench_handler, i, 0);
+	BENCH("event_dispatch (8 events)", g_bench_sink = event_dispatch());
+
+	bench_done();
+}
@@ -0,0 +1,40 @@
+/*
+ * bench_interrupt.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Interrupt.h"
+
+static void bench_callback(uint8_t edge, void *ctx)
+{
+}
+
+int main()
+{
+	bench_init();
+
+	BENCH("pcint_attach", g_bench_sink = pcint_attach(0, PB0, bench_callback, 0));
+	cli();
+
+	// Pin change vectors are built direct, the pin did not change
+	BENCH_ISR("PCINT0 (no change)", PCINT0_vect);
+
+	// Toggle PB0 through its output latch so the ISR finds one changed pin
+	DDRB |= (1 << DDB0);
+	PINB = (1 << PINB0);
+	BENCH_ISR("PCINT0 (1 pin)", PCINT0_vect);
+
+	for(uint8_t pin = PB1; pin <= PB7; pin++)
+		pcint_attach(0, pin, bench_callback, 0);
+	cli();
+	DDRB = 0xFF;
+	PINB = 0xFF;
+	BENCH_ISR("PCINT0 (8 pins)", PCINT0_vect);
+
+	BENCH("pcint_detach", pcint_detach(0, PB0));
+
+	bench_done();
+}
@@ -0,0 +1,38 @@
+/*
+ * bench_keypad.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Keypad.h"
+
+static const uint8_t g_bench_rows[] =
+{
+	KEYPAD_PIN(KEYPAD_PORT_C, 0), KEYPAD_PIN(KEYPAD_PORT_C, 1),
+	KEYPAD_PIN(KEYPAD_PORT_C, 2), KEYPAD_PIN(KEYPAD_PORT_C, 3)
+};
+
+static const uint8_t g_bench_columns[] =
+{
+	KEYPAD_PIN(KEYPAD_PORT_D, 4), KEYPAD_PIN(KEYPAD_PORT_D, 5),
+	KEYPAD_PIN(KEYPAD_PORT_D, 6), KEYPAD_PIN(KEYPAD_PORT_D, 7)
+};
+
+int main()
+{
+	uint8_t key;
+
+	bench_init();
+
+	BENCH("init_keypad", g_bench_sink = init_keypad(g_bench_rows, sizeof(g_bench_rows), g_bench_columns, sizeof(g_bench_columns)));
+	BENCH("keypad_tick", keypad_tick(0));
+	for(uint8_t i = 0; i < 64; i++)
+		keypad_tick(0);
+	BENCH("keypad_tick (settled)", keypad_tick(0));
+	BENCH("keypad_read (empty)", g_bench_sink = keypad_read(&key));
+	BENCH("keypad_ghosting", g_bench_sink = keypad_ghosting());
+
+	bench_done();
+}
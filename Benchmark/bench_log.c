@@ -0,0 +1,55 @@
+/*
+ * bench_log.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Log.h"
+
+// Same line through the text path and the binary log, the text path
+// blocks on UDRE0 so it also counts wire time at this baud rate
+#define BENCH_BAUD USART_BAUD_RATE_1M
+
+/* 
+ * Waits until the log is drained and the last frame is out, TXC0 is
+ * cleared again afterwards for the next wait
+ */
+static void bench_log_idle()
+{
+	log_flush();
+	while(!(UCSR0A & (1 << TXC0)));
+	UCSR0A = (1 << TXC0);
+}
+
+int main()
+{
+	bench_init();
+
+	init_usart(F_CPU, BENCH_BAUD, 0);
+	BENCH("init_log", init_log());
+
+	// Interrupts stay off, so only the call site is measured, not the drain
+	BENCH("LOG", LOG(LOG_BOOT));
+	BENCH("LOG2", LOG2(LOG_ADC_READING, 3, 1023));
+	BENCH("LOG_LONG", LOG_LONG(LOG_UPTIME, 123456789UL));
+	sei();
+	bench_log_idle();
+
+	BENCH("put_string + print_number (text)", {
+		put_string("adc");
+		print_number(3);
+		put_string(" = ");
+		print_number(1023);
+		print_line();
+	});
+	bench_log_idle();
+
+	// Drain cost per byte, called the way the hardware vector would be
+	cli();
+	LOG2(LOG_ADC_READING, 3, 1023);
+	BENCH_ISR("USART_UDRE", USART_UDRE_vect);
+
+	bench_done();
+}
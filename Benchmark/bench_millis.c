@@ -0,0 +1,24 @@
+/*
+ * bench_millis.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Millis.h"
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_millis", init_millis());
+	cli();
+
+	BENCH("millis", g_bench_sink = millis());
+	BENCH("micros", g_bench_sink = micros());
+	BENCH("micros64", g_bench_sink = (uint32_t) micros64());
+	BENCH_ISR("TIMER0_COMPA", TIMER0_COMPA_vect);
+
+	bench_done();
+}
@@ -0,0 +1,37 @@
+/*
+ * bench_scheduler.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Scheduler.h"
+
+static void bench_task()
+{
+}
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_scheduler", init_scheduler());
+	cli();
+
+	BENCH("sched_add_task", sched_add_task(SCHED_PRIORITY_0, bench_task));
+	for(uint8_t i = SCHED_PRIORITY_1; i < SCHED_MAX_TASKS; i++)
+		sched_add_task(i, bench_task);
+
+	BENCH("sched_post", sched_post(SCHED_PRIORITY_3));
+	BENCH("sched_post_delayed", sched_post_delayed(SCHED_PRIORITY_4, 10));
+	BENCH("sched_cancel", sched_cancel(SCHED_PRIORITY_3));
+
+	// Tick through the TIMER2_COMPA dispatch, with one and with every delay running
+	BENCH_ISR("TIMER2_COMPA (tick, 1 delayed)", TIMER2_COMPA_vect);
+	for(uint8_t i = 0; i < SCHED_MAX_TASKS; i++)
+		sched_post_delayed(i, 100);
+	BENCH_ISR("TIMER2_COMPA (tick, all delayed)", TIMER2_COMPA_vect);
+
+	bench_done();
+}
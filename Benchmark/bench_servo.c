@@ -0,0 +1,31 @@
+/*
+ * bench_servo.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Servo.h"
+
+int main()
+{
+	uint8_t channel = 0;
+
+	bench_init();
+
+	BENCH("init_servo", init_servo());
+	cli();
+
+	BENCH("servo_attach", channel = servo_attach(SERVO_PORT_B, PB1));
+	for(uint8_t pin = PD2; pin < PD2 + SERVO_MAX_CHANNELS - 1 && pin <= PD7; pin++)
+		servo_attach(SERVO_PORT_D, pin);
+	BENCH("servo_write_us", servo_write_us(channel, 1500));
+	BENCH("servo_write", servo_write(channel, 90));
+
+	BENCH_ISR("TIMER1_COMPA (even channel)", TIMER1_COMPA_vect);
+	BENCH_ISR("TIMER1_COMPB (odd channel)", TIMER1_COMPB_vect);
+	BENCH("servo_detach", servo_detach(channel));
+
+	bench_done();
+}
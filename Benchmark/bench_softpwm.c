@@ -0,0 +1,36 @@
+/*
+ * bench_softpwm.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "SoftPWM.h"
+
+int main()
+{
+	uint8_t channel;
+
+	bench_init();
+
+	BENCH("init_softpwm", init_softpwm());
+	cli();
+
+	BENCH("softpwm_add_channel", channel = softpwm_add_channel(SOFTPWM_PORT_B, PB0));
+	BENCH("softpwm_set_duty", softpwm_set_duty(channel, 64));
+	BENCH("softpwm_update (1 channel)", softpwm_update());
+
+	// Every channel on its own duty cycle, the worst case for the edge table
+	for(uint8_t pin = 1; pin < SOFTPWM_MAX_CHANNELS; pin++)
+	{
+		channel = softpwm_add_channel((pin < 8) ? SOFTPWM_PORT_B : SOFTPWM_PORT_D, pin & 0x07);
+		softpwm_set_duty(channel, (uint8_t) (255 - pin * 15));
+	}
+	BENCH("softpwm_update (16 channels)", softpwm_update());
+
+	BENCH_ISR("TIMER1_COMPA (frame swap)", TIMER1_COMPA_vect);
+	BENCH_ISR("TIMER1_COMPB (edge)", TIMER1_COMPB_vect);
+
+	bench_done();
+}
@@ -0,0 +1,37 @@
+/*
+ * bench_stepper.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Stepper.h"
+
+static const int32_t g_bench_move[STEPPER_MAX_AXES] = {4000, -1500, 250};
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_stepper", init_stepper());
+	cli();
+
+	BENCH("stepper_axis", stepper_axis(0, STEPPER_PORT_D, PD2, PD5));
+	stepper_axis(1, STEPPER_PORT_D, PD3, PD6);
+	stepper_axis(2, STEPPER_PORT_D, PD4, PD7);
+
+	// Ramp planning (floating point) happens here, not in the ISR
+	BENCH("stepper_move", g_bench_sink = stepper_move(g_bench_move, 8000, 20000));
+	BENCH("stepper_busy", g_bench_sink = stepper_busy());
+	BENCH("stepper_queue_free", g_bench_sink = stepper_queue_free());
+
+	// First call loads the move, the next ones step on the acceleration ramp
+	BENCH_ISR("TIMER1_COMPA (load move)", TIMER1_COMPA_vect);
+	BENCH_ISR("TIMER1_COMPA (step 1)", TIMER1_COMPA_vect);
+	BENCH_ISR("TIMER1_COMPA (step 2)", TIMER1_COMPA_vect);
+	BENCH_ISR("TIMER1_COMPB (pulse end)", TIMER1_COMPB_vect);
+	BENCH("stepper_position", g_bench_sink = stepper_position(0));
+
+	bench_done();
+}
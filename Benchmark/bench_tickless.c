@@ -0,0 +1,32 @@
+/*
+ * bench_tickless.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "Tickless.h"
+
+static void bench_callback(void *ctx)
+{
+}
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_tickless", init_tickless());
+	cli();
+
+	BENCH("tickless_now", g_bench_sink = tickless_now());
+	BENCH("tickless_timer_start", tickless_timer_start(0, TICKLESS_MS(100), 0, bench_callback, 0));
+	for(uint8_t id = 1; id < TICKLESS_MAX_TIMERS; id++)
+		tickless_timer_start(id, TICKLESS_MS(200) * id, TICKLESS_MS(200), bench_callback, 0);
+
+	BENCH_ISR("TIMER2_OVF", TIMER2_OVF_vect);
+	BENCH_ISR("TIMER2_COMPA (nothing due)", TIMER2_COMPA_vect);
+	BENCH("tickless_timer_stop", tickless_timer_stop(0));
+
+	bench_done();
+}
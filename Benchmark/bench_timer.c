@@ -0,0 +1,39 @@
+/*
+ * bench_timer.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "TIMER.h"
+
+static void bench_callback(void *ctx)
+{
+}
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_timer1", init_timer1(WAVEFORM_CTC_OCR1A, 10, COMPARE_NORMAL, TIMER1_PRESCALER_64, 0, 0));
+	BENCH("value_timer1", g_bench_sink = value_timer1());
+	BENCH("check_timer1_overflow", g_bench_sink = check_timer1_overflow());
+	BENCH("stop_timer1", stop_timer1());
+
+	BENCH("init_pwm_timer1", init_pwm_timer1(PWM_MODE_FAST, 0x03FF, PWM_CHANNEL_A | PWM_CHANNEL_B,
+		PWM_OUTPUT_NON_INVERTING, TIMER1_PRESCALER_1));
+	BENCH("set_pwm_timer1_frequency", g_bench_sink = set_pwm_timer1_frequency(20000));
+	BENCH("set_pwm_timer1_duty", set_pwm_timer1_duty(PWM_CHANNEL_A, 300));
+	BENCH("set_pwm_timer0_duty", set_pwm_timer0_duty(PWM_CHANNEL_A, 128));
+
+	// Dispatched vectors (TIMER2_COMPA and TIMER0_COMPB are built direct)
+	BENCH_ISR("TIMER2_COMPA (detached)", TIMER2_COMPA_vect);
+	BENCH("timer_attach", g_bench_sink = timer_attach(TIMER2_COMPA, bench_callback, 0));
+	BENCH_ISR("TIMER2_COMPA (dispatch)", TIMER2_COMPA_vect);
+	timer_attach(TIMER0_COMPB, bench_callback, 0);
+	BENCH_ISR("TIMER0_COMPB (dispatch)", TIMER0_COMPB_vect);
+	BENCH("timer_detach", timer_detach(TIMER2_COMPA));
+
+	bench_done();
+}
@@ -0,0 +1,54 @@
+/*
+ * bench_usart.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "bench.h"
+#include "USART.h"
+
+// Transmit paths block on UDRE0, so anything longer than the two-byte
+// buffer also counts wire time at this baud rate
+#define BENCH_BAUD USART_BAUD_RATE_1M
+
+static const char g_bench_text[] = "benchmark";
+
+/* 
+ * Waits until the last frame is out, so each run starts with empty buffers
+ * TXC0 only sets once both UDR0 and the shift register are empty, it is
+ * cleared again for the next wait. Only called after something was sent.
+ */
+static void bench_usart_idle()
+{
+	while(!(UCSR0A & (1 << UDRE0)));
+	while(!(UCSR0A & (1 << TXC0)));
+	UCSR0A = (1 << TXC0);
+}
+
+int main()
+{
+	bench_init();
+
+	BENCH("init_usart", init_usart(F_CPU, BENCH_BAUD, 0));
+
+	// 'A' goes straight on to the shift register, 'B' fills UDR0, so 'C'
+	// waits for 'A' to be out
+	BENCH("tx_byte", tx_byte('A'));
+	tx_byte('B');
+	BENCH("tx_byte (buffer full)", tx_byte('C'));
+
+	bench_usart_idle();
+	BENCH("print_byte", print_byte(200));
+
+	bench_usart_idle();
+	BENCH("print_number", print_number(65535));
+
+	bench_usart_idle();
+	BENCH("put_string", put_string(g_bench_text));
+
+	bench_usart_idle();
+	BENCH("print_line", print_line());
+
+	bench_done();
+}
@@ -0,0 +1,182 @@
+/*
+ * runner.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim_avr.h"
+#include "sim_elf.h"
+#include "sim_io.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Runner Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Host program: runs one benchmark ELF on simavr and prints a line per
+ * BENCH() measurement to stdout:
+ *	<name> <tab> <cycles> <tab> <stack bytes>
+ * Cycles exclude the calibrated marker overhead, stack is the deepest the
+ * stack pointer went below its value at the begin marker.
+ */
+#define RUNNER_MCU "atmega328p"
+#define RUNNER_FREQUENCY 16000000UL
+
+// Marker registers (data space), see bench.h
+#define RUNNER_MARK_ADDR 0x3E		// GPIOR0
+#define RUNNER_NAME_ADDR 0x4B		// GPIOR2
+
+#define RUNNER_MARK_BEGIN 1
+#define RUNNER_MARK_END 2
+#define RUNNER_MARK_DONE 0xFF
+
+#define RUNNER_NAME_SIZE 64
+
+// Gives up on firmware that never reaches bench_done()
+#define RUNNER_CYCLE_LIMIT (60ULL * RUNNER_FREQUENCY)
+
+typedef struct
+{
+	char name[RUNNER_NAME_SIZE];
+	uint8_t name_length;
+	uint8_t name_closed;		// Terminator seen, the next character starts a new name
+	uint8_t open;				// Between begin and end markers
+	uint8_t done;
+	avr_cycle_count_t begin;
+	avr_cycle_count_t overhead;
+	uint16_t sp_begin;
+	uint16_t sp_min;
+} runner_t;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Runner Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+static uint16_t runner_sp(avr_t *avr)
+{
+	return (uint16_t) (avr->data[R_SPL] | (avr->data[R_SPH] << 8));
+}
+
+static void runner_name_write(avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param)
+{
+	runner_t *p_runner = (runner_t *) param;
+
+	avr->data[addr] = v;
+	if(p_runner->name_closed)
+	{
+		p_runner->name_length = 0;
+		p_runner->name_closed = 0;
+	}
+
+	if(!v)
+		p_runner->name_closed = 1;
+	else if(p_runner->name_length < RUNNER_NAME_SIZE - 1)
+		p_runner->name[p_runner->name_length++] = (char) v;
+	p_runner->name[p_runner->name_length] = '\0';
+}
+
+static void runner_mark_write(avr_t *avr, avr_io_addr_t addr, uint8_t v, void *param)
+{
+	runner_t *p_runner = (runner_t *) param;
+	avr_cycle_count_t cycles;
+
+	avr->data[addr] = v;
+	switch(v)
+	{
+		case RUNNER_MARK_BEGIN:
+			p_runner->open = 1;
+			p_runner->begin = avr->cycle;
+			p_runner->sp_begin = runner_sp(avr);
+			p_runner->sp_min = p_runner->sp_begin;
+			break;
+
+		case RUNNER_MARK_END:
+			if(!p_runner->open)
+				break;
+			p_runner->open = 0;
+			cycles = avr->cycle - p_runner->begin;
+
+			// The unnamed measurement from bench_init() is the marker overhead
+			if(!p_runner->name[0])
+			{
+				p_runner->overhead = cycles;
+				break;
+			}
+			cycles = (cycles > p_runner->overhead) ? cycles - p_runner->overhead : 0;
+			printf("%s\t%llu\t%u\n", p_runner->name, (unsigned long long) cycles,
+				(unsigned) (p_runner->sp_begin - p_runner->sp_min));
+			break;
+
+		case RUNNER_MARK_DONE:
+			p_runner->done = 1;
+			break;
+
+		default:
+			break;
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	elf_firmware_t firmware;
+	runner_t runner;
+	avr_t *avr;
+	uint16_t sp;
+	int state;
+
+	if(argc != 2)
+	{
+		fprintf(stderr, "usage: %s bench.elf\n", argv[0]);
+		return 2;
+	}
+
+	memset(&firmware, 0, sizeof(firmware));
+	memset(&runner, 0, sizeof(runner));
+	if(elf_read_firmware(argv[1], &firmware))
+	{
+		fprintf(stderr, "%s: cannot read %s\n", argv[0], argv[1]);
+		return 2;
+	}
+
+	avr = avr_make_mcu_by_name(firmware.mmcu[0] ? firmware.mmcu : RUNNER_MCU);
+	if(!avr)
+	{
+		fprintf(stderr, "%s: unknown MCU\n", argv[0]);
+		return 2;
+	}
+	avr_init(avr);
+	avr->log = LOG_ERROR;
+	avr_load_firmware(avr, &firmware);
+	avr->frequency = firmware.frequency ? firmware.frequency : RUNNER_FREQUENCY;
+
+	avr_register_io_write(avr, RUNNER_MARK_ADDR, runner_mark_write, &runner);
+	avr_register_io_write(avr, RUNNER_NAME_ADDR, runner_name_write, &runner);
+
+	// One instruction per avr_run(), so the stack pointer is seen after each
+	while(!runner.done && avr->cycle < RUNNER_CYCLE_LIMIT)
+	{
+		state = avr_run(avr);
+		if(state == cpu_Done || state == cpu_Crashed)
+			break;
+		if(runner.open)
+		{
+			sp = runner_sp(avr);
+			if(sp < runner.sp_min)
+				runner.sp_min = sp;
+		}
+	}
+
+	avr_terminate(avr);
+	if(!runner.done)
+	{
+		fprintf(stderr, "%s: %s did not finish\n", argv[0], argv[1]);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * button.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Button.h"
+#include "Ring.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Button Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define BUTTON_MS(ms) ((ms) / BUTTON_TICK_MS)
+
+// Gesture states
+#define BUTTON_STATE_IDLE 0
+#define BUTTON_STATE_HELD 1	  // Pressed, timing long press and repeat
+#define BUTTON_STATE_WAIT 2	  // Released once, waiting for a second click
+#define BUTTON_STATE_LONG 3	  // Long press sent, the release is no click
+
+typedef struct
+{
+	uint8_t port;
+	uint8_t mask;
+	uint8_t state;
+	uint8_t clicks;		  // '1' while a second press makes a double click
+	uint8_t repeated;	  // '1' once the press repeated, its release is no click
+	uint16_t ticks;		  // Ticks in the current state
+	uint16_t next_repeat; // Held ticks of the next repeat
+	uint16_t long_ticks;
+	uint16_t double_ticks;
+	uint16_t repeat_delay_ticks;
+	uint16_t repeat_ticks;
+} button_t;
+
+static button_t g_buttons[BUTTON_MAX];
+static volatile uint8_t g_button_count;
+
+// Events as (id << 4) | event, button_tick() puts and button_read() gets
+static uint8_t g_button_buffer[BUTTON_QUEUE_SIZE];
+static ring_t g_button_queue = RING_INIT(g_button_buffer);
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Button Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Add a Button on a Debounced Pin, with the default timings
+ * Port '0': Port B, '1': Port C, '2': Port D
+ * Returns its id, or BUTTON_NO_BUTTON
+ */
+uint8_t button_add(uint8_t port, uint8_t pin)
+{
+	uint8_t id = g_button_count;
+
+	if(id >= BUTTON_MAX || port > DEBOUNCE_PORT_D || pin > 7)
+		return BUTTON_NO_BUTTON;
+
+	button_t *button = &g_buttons[id];
+	button->port = port;
+	button->mask = (1 << pin);
+	button->state = BUTTON_STATE_IDLE;
+	button->clicks = 0;
+	button->repeated = 0;
+	button->ticks = 0;
+	button_set_timing(id, BUTTON_LONG_MS, BUTTON_DOUBLE_MS, BUTTON_REPEAT_DELAY_MS, BUTTON_REPEAT_MS);
+
+	init_debounce(port, button->mask);
+
+	// The tick only sees the button once it is complete
+	g_button_count = id + 1;
+	return id;
+}
+
+/* Set the Timings of a Button in Milliseconds, '0' disables a gesture */
+void button_set_timing(uint8_t id, uint16_t long_ms, uint16_t double_ms, uint16_t repeat_delay_ms, uint16_t repeat_ms)
+{
+	if(id >= BUTTON_MAX)
+		return;
+
+	button_t *button = &g_buttons[id];
+	CRITICAL_BLOCK()
+	{
+		button->long_ticks = BUTTON_MS(long_ms);
+		button->double_ticks = BUTTON_MS(double_ms);
+		button->repeat_delay_ticks = BUTTON_MS(repeat_delay_ms);
+		button->repeat_ticks = BUTTON_MS(repeat_ms);
+	}
+}
+
+/* Queue an Event, a full queue drops it */
+static inline void button_emit(uint8_t id, uint8_t event)
+{
+	ring_put(&g_button_queue, (id << 4) | event);
+}
+
+/* 
+ * Advance every Gesture State Machine by one Tick, timer_callback_t compatible
+ * Press and release come from the debounced level of each pin
+ */
+void button_tick(void *ctx)
+{
+	uint8_t count = g_button_count;
+
+	for(uint8_t id = 0; id < count; id++)
+	{
+		button_t *button = &g_buttons[id];
+		uint8_t down = debounce_state(button->port) & button->mask;
+
+		if(button->ticks != 0xFFFF)
+			button->ticks++;
+
+		switch(button->state)
+		{
+			case BUTTON_STATE_IDLE:
+			case BUTTON_STATE_WAIT:
+				if(down)
+				{
+					button_emit(id, BUTTON_EVENT_PRESS);
+					button->state = BUTTON_STATE_HELD;
+					button->ticks = 0;
+					button->next_repeat = button->repeat_delay_ticks;
+					button->repeated = 0;
+				}
+				else if(button->state == BUTTON_STATE_WAIT && button->ticks >= button->double_ticks)
+				{
+					// No second click in time
+					button_emit(id, BUTTON_EVENT_CLICK);
+					button->state = BUTTON_STATE_IDLE;
+					button->clicks = 0;
+				}
+				break;
+
+			case BUTTON_STATE_HELD:
+			case BUTTON_STATE_LONG:
+				if(!down)
+				{
+					button_emit(id, BUTTON_EVENT_RELEASE);
+					
+					if(button->state == BUTTON_STATE_LONG || button->repeated)
+					{
+						button->state = BUTTON_STATE_IDLE;
+						button->clicks = 0;
+					}
+					else if(button->clicks)
+					{
+						button_emit(id, BUTTON_EVENT_DOUBLE_CLICK);
+						button->state = BUTTON_STATE_IDLE;
+						button->clicks = 0;
+					}
+					else if(button->double_ticks)
+					{
+						button->state = BUTTON_STATE_WAIT;
+						button->clicks = 1;
+					}
+					else
+					{
+						// Double click disabled, no need to wait
+						button_emit(id, BUTTON_EVENT_CLICK);
+						button->state = BUTTON_STATE_IDLE;
+					}
+					button->ticks = 0;
+					break;
+				}
+
+				if(button->state == BUTTON_STATE_HELD && button->long_ticks && button->ticks == button->long_ticks)
+				{
+					// A second press held long is no double click, the first still counts
+					if(button->clicks)
+					{
+						button_emit(id, BUTTON_EVENT_CLICK);
+						button->clicks = 0;
+					}
+					button_emit(id, BUTTON_EVENT_LONG_PRESS);
+					button->state = BUTTON_STATE_LONG;
+				}
+
+				if(button->repeat_ticks && button->next_repeat && button->ticks == button->next_repeat)
+				{
+					// Same as a long press: the first click still counts, this press does not
+					if(button->clicks)
+					{
+						button_emit(id, BUTTON_EVENT_CLICK);
+						button->clicks = 0;
+					}
+					button->repeated = 1;
+
+					button_emit(id, BUTTON_EVENT_REPEAT);
+					button->next_repeat += button->repeat_ticks;
+					
+					// Repeating for the whole counter range, stop
+					if(button->next_repeat < button->ticks)
+						button->next_repeat = 0;
+				}
+				break;
+		}
+	}
+}
+
+/* 
+ * Take the Oldest Event
+ * Returns '0' if there is none
+ */
+uint8_t button_read(uint8_t *id, uint8_t *event)
+{
+	uint8_t entry;
+
+	if(!ring_get(&g_button_queue, &entry))
+		return 0;
+
+	*id = entry >> 4;
+	*event = entry & 0x0F;
+	return 1;
+}
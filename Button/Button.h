@@ -0,0 +1,91 @@
+/*
+ * button.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _BUTTON_H_
+#define _BUTTON_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include "Debounce.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Button Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// button_tick() follows the debounced levels, call it right after
+// debounce_tick() from the same timer tick
+#ifndef BUTTON_MAX
+#define BUTTON_MAX 8
+#endif
+
+#ifndef BUTTON_TICK_MS
+#define BUTTON_TICK_MS 1
+#endif
+
+// Queued events, power of two
+#ifndef BUTTON_QUEUE_SIZE
+#define BUTTON_QUEUE_SIZE 16
+#endif
+
+#if (BUTTON_QUEUE_SIZE & (BUTTON_QUEUE_SIZE - 1)) != 0 || BUTTON_QUEUE_SIZE > 256
+#error "Button: BUTTON_QUEUE_SIZE must be a power of two up to 256"
+#endif
+#if BUTTON_MAX > 16
+#error "Button: BUTTON_MAX is limited to 16"
+#endif
+
+// Default timings in milliseconds, '0' disables the gesture
+#ifndef BUTTON_LONG_MS
+#define BUTTON_LONG_MS 800
+#endif
+#ifndef BUTTON_DOUBLE_MS
+#define BUTTON_DOUBLE_MS 300
+#endif
+#ifndef BUTTON_REPEAT_DELAY_MS
+#define BUTTON_REPEAT_DELAY_MS 500
+#endif
+#ifndef BUTTON_REPEAT_MS
+#define BUTTON_REPEAT_MS 100
+#endif
+
+// Events. A press held to its first REPEAT or to LONG_PRESS is not a click:
+// its release only sends RELEASE. Both gestures run on the same hold, with
+// the defaults REPEAT starts at 500 ms and LONG_PRESS follows at 800 ms; set
+// repeat_ms or long_ms to 0 for a button that should only do one of them.
+// A click waiting for its double click window is sent before either.
+#define BUTTON_EVENT_PRESS 0
+#define BUTTON_EVENT_RELEASE 1
+#define BUTTON_EVENT_CLICK 2		// Single click, after the double click window
+#define BUTTON_EVENT_DOUBLE_CLICK 3
+#define BUTTON_EVENT_LONG_PRESS 4
+#define BUTTON_EVENT_REPEAT 5		// While held
+
+#define BUTTON_NO_BUTTON 0xFF
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Button Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+uint8_t button_add(uint8_t port, uint8_t pin);
+void button_set_timing(uint8_t id, uint16_t long_ms, uint16_t double_ms, uint16_t repeat_delay_ms, uint16_t repeat_ms);
+void button_tick(void *ctx);
+uint8_t button_read(uint8_t *id, uint8_t *event);
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _BUTTON_H_ */
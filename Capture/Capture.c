@@ -0,0 +1,235 @@
+/*
+ * capture.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Capture.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Capture Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+static volatile uint16_t g_capture_overflows; // Upper 16 bits of the timestamps
+static volatile uint8_t g_capture_idle;		  // Overflows since the last edge
+
+static uint8_t g_capture_mode;
+static uint8_t g_capture_average;	  // Periods accumulated per result
+static uint32_t g_capture_frequency;  // Timer 1 ticks per second
+
+// Working state, only touched by the Capture Interrupt
+static uint8_t g_capture_valid; // A reference edge has been seen
+static uint32_t g_capture_last_edge;
+static uint32_t g_capture_high;
+static uint32_t g_capture_period_sum;
+static uint32_t g_capture_high_sum;
+static uint8_t g_capture_count;
+
+// Published result, a sum of g_capture_average periods
+static volatile uint32_t g_result_period_sum;
+static volatile uint32_t g_result_high_sum;
+static volatile uint8_t g_result_count;
+static volatile uint8_t g_result_ready;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Capture Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Initialize the Input Capture Engine on ICP1 (PB0)
+ * prescaler: TIMER1_PRESCALER_1 to TIMER1_PRESCALER_1024
+ * mode: CAPTURE_MODE_PERIOD or CAPTURE_MODE_DUTY
+ * edge: First edge measured, CAPTURE_EDGE_RISING or CAPTURE_EDGE_FALLING
+ * average: Periods averaged per result, 1 - 255
+ */
+void init_capture(uint16_t prescaler, uint8_t mode, uint8_t edge, uint8_t average)
+{
+	static const uint16_t dividers[] = { 1, 1, 8, 64, 256, 1024 };
+
+	stop_capture();
+
+	if(prescaler < TIMER1_PRESCALER_1 || prescaler > TIMER1_PRESCALER_1024)
+		prescaler = TIMER1_PRESCALER_1;
+	if(!average)
+		average = 1;
+
+	g_capture_mode = mode;
+	g_capture_average = average;
+	g_capture_frequency = (F_CPU) / dividers[prescaler];
+	g_capture_overflows = 0;
+	g_capture_idle = 0;
+	g_capture_valid = 0;
+	g_capture_period_sum = 0;
+	g_capture_high_sum = 0;
+	g_capture_high = 0;
+	g_capture_count = 0;
+	g_result_count = 0;
+	g_result_ready = 0;
+
+	// ICP1 as Input
+	DDRB &= ~(1 << PB0);
+
+	// Normal Mode
+	// (TCCR1A): TC1 Control Register A
+	TCCR1A = 0;
+	TCNT1 = 0;
+	
+	// (TCCR1B): TC1 Control Register B
+	// (ICNC1): Input Capture Noise Canceler, filters edges shorter than 4 clocks
+	// (ICES1): Input Capture Edge Select, '1': Rising, '0': Falling
+	TCCR1B = (1 << ICNC1) | (edge ? (1 << ICES1) : 0);
+
+	// (TIFR1): Clear stale Capture and Overflow Flags
+	TIFR1 = (1 << ICF1) | (1 << TOV1);
+
+	// (TIMSK1): Timer/Counter 1 Interrupt Mask Register
+	// (ICIE1): Input Capture Interrupt Enable, (TOIE1): Overflow Interrupt Enable
+	TIMSK1 = (1 << ICIE1) | (1 << TOIE1);
+	
+	// Start the Timer
+	// (CS1n): Clock Select 1 [n = 0:2]
+	TCCR1B |= (prescaler << CS10);
+
+	critical_sei();
+}
+
+/* Stop the Input Capture Engine */
+void stop_capture()
+{
+	TIMSK1 &= ~((1 << ICIE1) | (1 << TOIE1));
+	TCCR1B &= ~((1 << CS12) | (1 << CS11) | (1 << CS10));
+}
+
+/* Returns '1' once a new averaged result has been published */
+uint8_t capture_available()
+{
+	return g_result_ready;
+}
+
+/* Copies the Published Result, returns the number of periods in it */
+static uint8_t read_result(uint32_t *period_sum, uint32_t *high_sum)
+{
+	uint8_t count;
+	CRITICAL_BLOCK()
+	{
+		*period_sum = g_result_period_sum;
+		*high_sum = g_result_high_sum;
+		count = g_result_count;
+		g_result_ready = 0;
+	}
+	return count;
+}
+
+/* Averaged Period in Timer 1 Ticks, '0' if the signal stopped */
+uint32_t capture_period()
+{
+	uint32_t period_sum, high_sum;
+	uint8_t count = read_result(&period_sum, &high_sum);
+	if(!count)
+		return 0;
+	return period_sum / count;
+}
+
+/* Averaged Period in Microseconds, '0' if the signal stopped */
+uint32_t capture_period_us()
+{
+	uint32_t period_sum, high_sum;
+	uint8_t count = read_result(&period_sum, &high_sum);
+	if(!count)
+		return 0;
+	return (uint32_t) ((uint64_t) period_sum * 1000000UL / ((uint64_t) g_capture_frequency * count));
+}
+
+/* Averaged Frequency in Hundredths of Hz, '0' if the signal stopped */
+uint32_t capture_frequency_centihz()
+{
+	uint32_t period_sum, high_sum;
+	uint8_t count = read_result(&period_sum, &high_sum);
+	if(!period_sum)
+		return 0;
+	return (uint32_t) ((uint64_t) g_capture_frequency * 100UL * count / period_sum);
+}
+
+/* Averaged Duty Cycle in Tenths of Percent (CAPTURE_MODE_DUTY only) */
+uint16_t capture_duty_permille()
+{
+	uint32_t period_sum, high_sum;
+	read_result(&period_sum, &high_sum);
+	if(!period_sum)
+		return 0;
+	return (uint16_t) ((uint64_t) high_sum * 1000UL / period_sum);
+}
+
+/* Overflow Interrupt, extends the timestamps to 32 bits */
+ISR(TIMER1_OVF_vect)
+{
+	g_capture_overflows++;
+	
+	// No edges for a while, publish a stopped signal
+	if(g_capture_idle < CAPTURE_TIMEOUT_OVERFLOWS && ++g_capture_idle == CAPTURE_TIMEOUT_OVERFLOWS)
+	{
+		g_capture_valid = 0;
+		g_capture_count = 0;
+		g_capture_period_sum = 0;
+		g_capture_high_sum = 0;
+		g_result_period_sum = 0;
+		g_result_high_sum = 0;
+		g_result_count = 0;
+		g_result_ready = 1;
+	}
+}
+
+/* Capture Interrupt */
+ISR(TIMER1_CAPT_vect)
+{
+	// (ICR1): TC1 Input Capture Register
+	uint16_t icr = ICR1;
+	uint16_t overflows = g_capture_overflows;
+	uint8_t rising = (TCCR1B & (1 << ICES1)) != 0;
+
+	// An overflow is pending and the capture happened after it
+	if((TIFR1 & (1 << TOV1)) && icr < 0x8000)
+		overflows++;
+	
+	uint32_t now = ((uint32_t) overflows << 16) | icr;
+	g_capture_idle = 0;
+
+	if(g_capture_mode == CAPTURE_MODE_DUTY)
+	{
+		// Next edge of the opposite polarity
+		// Changing ICES1 may set ICF1, clear it right after
+		TCCR1B ^= (1 << ICES1);
+		TIFR1 = (1 << ICF1);
+		
+		// The high time ends at the falling edge
+		if(!rising)
+		{
+			if(g_capture_valid)
+				g_capture_high = now - g_capture_last_edge;
+			return;
+		}
+	}
+
+	if(g_capture_valid)
+	{
+		g_capture_period_sum += now - g_capture_last_edge;
+		g_capture_high_sum += g_capture_high;
+
+		if(++g_capture_count >= g_capture_average)
+		{
+			g_result_period_sum = g_capture_period_sum;
+			g_result_high_sum = g_capture_high_sum;
+			g_result_count = g_capture_count;
+			g_result_ready = 1;
+			g_capture_period_sum = 0;
+			g_capture_high_sum = 0;
+			g_capture_count = 0;
+		}
+	}
+
+	g_capture_last_edge = now;
+	g_capture_valid = 1;
+}
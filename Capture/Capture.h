@@ -0,0 +1,63 @@
+/*
+ * capture.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _CAPTURE_H_
+#define _CAPTURE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Capture Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 1 runs in Normal mode and its Capture and Overflow vectors
+// are owned by this module, leave TIMER1_CAPT_DISPATCH and
+// TIMER1_OVF_DISPATCH compiled out.
+// The signal is read on ICP1 (PB0).
+#if TIMER1_CAPT_DISPATCH || TIMER1_OVF_DISPATCH
+#error "Capture: TIMER1_CAPT and TIMER1_OVF are taken by this module, set TIMER1_CAPT_DISPATCH and TIMER1_OVF_DISPATCH to 0"
+#endif
+
+#define CAPTURE_MODE_PERIOD 0 // One edge polarity, period only
+#define CAPTURE_MODE_DUTY 1	  // Alternating polarity, period and high time
+
+#define CAPTURE_EDGE_FALLING 0
+#define CAPTURE_EDGE_RISING 1
+
+// Overflows without an edge before the signal is considered stopped
+#define CAPTURE_TIMEOUT_OVERFLOWS 64
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Capture Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_capture(uint16_t prescaler, uint8_t mode, uint8_t edge, uint8_t average);
+void stop_capture();
+uint8_t capture_available();
+uint32_t capture_period();
+uint32_t capture_period_us();
+uint32_t capture_frequency_centihz();
+uint16_t capture_duty_permille();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _CAPTURE_H_ */
@@ -0,0 +1,244 @@
+/*
+ * dds.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "DDS.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							DDS Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+static const uint8_t g_dds_sine[256] PROGMEM = {
+	0x80, 0x83, 0x86, 0x89, 0x8C, 0x8F, 0x92, 0x95, 0x98, 0x9B, 0x9E, 0xA2, 0xA5, 0xA7, 0xAA, 0xAD,
+	0xB0, 0xB3, 0xB6, 0xB9, 0xBC, 0xBE, 0xC1, 0xC4, 0xC6, 0xC9, 0xCB, 0xCE, 0xD0, 0xD3, 0xD5, 0xD7,
+	0xDA, 0xDC, 0xDE, 0xE0, 0xE2, 0xE4, 0xE6, 0xE8, 0xEA, 0xEB, 0xED, 0xEE, 0xF0, 0xF1, 0xF3, 0xF4,
+	0xF5, 0xF6, 0xF8, 0xF9, 0xFA, 0xFA, 0xFB, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFE, 0xFD, 0xFD, 0xFC, 0xFB, 0xFA, 0xFA, 0xF9, 0xF8, 0xF6,
+	0xF5, 0xF4, 0xF3, 0xF1, 0xF0, 0xEE, 0xED, 0xEB, 0xEA, 0xE8, 0xE6, 0xE4, 0xE2, 0xE0, 0xDE, 0xDC,
+	0xDA, 0xD7, 0xD5, 0xD3, 0xD0, 0xCE, 0xCB, 0xC9, 0xC6, 0xC4, 0xC1, 0xBE, 0xBC, 0xB9, 0xB6, 0xB3,
+	0xB0, 0xAD, 0xAA, 0xA7, 0xA5, 0xA2, 0x9E, 0x9B, 0x98, 0x95, 0x92, 0x8F, 0x8C, 0x89, 0x86, 0x83,
+	0x80, 0x7C, 0x79, 0x76, 0x73, 0x70, 0x6D, 0x6A, 0x67, 0x64, 0x61, 0x5D, 0x5A, 0x58, 0x55, 0x52,
+	0x4F, 0x4C, 0x49, 0x46, 0x43, 0x41, 0x3E, 0x3B, 0x39, 0x36, 0x34, 0x31, 0x2F, 0x2C, 0x2A, 0x28,
+	0x25, 0x23, 0x21, 0x1F, 0x1D, 0x1B, 0x19, 0x17, 0x15, 0x14, 0x12, 0x11, 0x0F, 0x0E, 0x0C, 0x0B,
+	0x0A, 0x09, 0x07, 0x06, 0x05, 0x05, 0x04, 0x03, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x02, 0x02, 0x03, 0x04, 0x05, 0x05, 0x06, 0x07, 0x09,
+	0x0A, 0x0B, 0x0C, 0x0E, 0x0F, 0x11, 0x12, 0x14, 0x15, 0x17, 0x19, 0x1B, 0x1D, 0x1F, 0x21, 0x23,
+	0x25, 0x28, 0x2A, 0x2C, 0x2F, 0x31, 0x34, 0x36, 0x39, 0x3B, 0x3E, 0x41, 0x43, 0x46, 0x49, 0x4C,
+	0x4F, 0x52, 0x55, 0x58, 0x5A, 0x5D, 0x61, 0x64, 0x67, 0x6A, 0x6D, 0x70, 0x73, 0x76, 0x79, 0x7C
+};
+
+static const uint8_t g_dds_triangle[256] PROGMEM = {
+	0x00, 0x02, 0x04, 0x06, 0x08, 0x0A, 0x0C, 0x0E, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A, 0x1C, 0x1E,
+	0x20, 0x22, 0x24, 0x26, 0x28, 0x2A, 0x2C, 0x2E, 0x30, 0x32, 0x34, 0x36, 0x38, 0x3A, 0x3C, 0x3E,
+	0x40, 0x42, 0x44, 0x46, 0x48, 0x4A, 0x4C, 0x4E, 0x50, 0x52, 0x54, 0x56, 0x58, 0x5A, 0x5C, 0x5E,
+	0x60, 0x62, 0x64, 0x66, 0x68, 0x6A, 0x6C, 0x6E, 0x70, 0x72, 0x74, 0x76, 0x78, 0x7A, 0x7C, 0x7E,
+	0x80, 0x82, 0x84, 0x86, 0x88, 0x8A, 0x8C, 0x8E, 0x90, 0x92, 0x94, 0x96, 0x98, 0x9A, 0x9C, 0x9E,
+	0xA0, 0xA2, 0xA4, 0xA6, 0xA8, 0xAA, 0xAC, 0xAE, 0xB0, 0xB2, 0xB4, 0xB6, 0xB8, 0xBA, 0xBC, 0xBE,
+	0xC0, 0xC2, 0xC4, 0xC6, 0xC8, 0xCA, 0xCC, 0xCE, 0xD0, 0xD2, 0xD4, 0xD6, 0xD8, 0xDA, 0xDC, 0xDE,
+	0xE0, 0xE2, 0xE4, 0xE6, 0xE8, 0xEA, 0xEC, 0xEE, 0xF0, 0xF2, 0xF4, 0xF6, 0xF8, 0xFA, 0xFC, 0xFE,
+	0xFF, 0xFD, 0xFB, 0xF9, 0xF7, 0xF5, 0xF3, 0xF1, 0xEF, 0xED, 0xEB, 0xE9, 0xE7, 0xE5, 0xE3, 0xE1,
+	0xDF, 0xDD, 0xDB, 0xD9, 0xD7, 0xD5, 0xD3, 0xD1, 0xCF, 0xCD, 0xCB, 0xC9, 0xC7, 0xC5, 0xC3, 0xC1,
+	0xBF, 0xBD, 0xBB, 0xB9, 0xB7, 0xB5, 0xB3, 0xB1, 0xAF, 0xAD, 0xAB, 0xA9, 0xA7, 0xA5, 0xA3, 0xA1,
+	0x9F, 0x9D, 0x9B, 0x99, 0x97, 0x95, 0x93, 0x91, 0x8F, 0x8D, 0x8B, 0x89, 0x87, 0x85, 0x83, 0x81,
+	0x7F, 0x7D, 0x7B, 0x79, 0x77, 0x75, 0x73, 0x71, 0x6F, 0x6D, 0x6B, 0x69, 0x67, 0x65, 0x63, 0x61,
+	0x5F, 0x5D, 0x5B, 0x59, 0x57, 0x55, 0x53, 0x51, 0x4F, 0x4D, 0x4B, 0x49, 0x47, 0x45, 0x43, 0x41,
+	0x3F, 0x3D, 0x3B, 0x39, 0x37, 0x35, 0x33, 0x31, 0x2F, 0x2D, 0x2B, 0x29, 0x27, 0x25, 0x23, 0x21,
+	0x1F, 0x1D, 0x1B, 0x19, 0x17, 0x15, 0x13, 0x11, 0x0F, 0x0D, 0x0B, 0x09, 0x07, 0x05, 0x03, 0x01
+};
+
+static const uint8_t g_dds_sawtooth[256] PROGMEM = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+	0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F,
+	0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 0x6E, 0x6F,
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F,
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F,
+	0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF,
+	0xB0, 0xB1, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xBB, 0xBC, 0xBD, 0xBE, 0xBF,
+	0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF,
+	0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF,
+	0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF,
+	0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
+};
+
+static const uint8_t g_dds_square[256] PROGMEM = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static const uint8_t * const g_dds_waves[] = {
+	g_dds_sine, g_dds_triangle, g_dds_sawtooth, g_dds_square
+};
+
+typedef struct
+{
+	uint32_t phase;	   // Phase accumulator, the top byte indexes the table
+	uint32_t tuning;   // Phase step per sample
+	const uint8_t *table;
+	uint8_t amplitude;
+} dds_channel_t;
+
+static volatile dds_channel_t g_dds_channels[2];
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							DDS Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Initialize the Synthesizer on Timer 2
+ * channels: PWM_CHANNEL_A, PWM_CHANNEL_B or both, starts silent at mid-scale
+ */
+void init_dds(uint8_t channels)
+{
+	stop_timer2();
+
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		g_dds_channels[i].phase = 0;
+		g_dds_channels[i].tuning = 0;
+		g_dds_channels[i].table = g_dds_sine;
+		g_dds_channels[i].amplitude = DDS_AMPLITUDE_FULL;
+	}
+
+	// Fast PWM, TOP = 0xFF, Non-Inverting Outputs
+	// (TCCR2A): TC2 Control Register A
+	// (COM2x1): Clear OC2x on Compare Match
+	TCCR2A = (1 << WGM21) | (1 << WGM20);
+	OCR2A = 0x80;
+	OCR2B = 0x80;
+
+	if(channels & PWM_CHANNEL_A)
+	{
+		TCCR2A |= (1 << COM2A1);
+		DDRB |= (1 << DDB3);
+	}
+	if(channels & PWM_CHANNEL_B)
+	{
+		TCCR2A |= (1 << COM2B1);
+		DDRD |= (1 << DDD3);
+	}
+
+	// (TIMSK2): Overflow Interrupt
+	TIFR2 = (1 << TOV2);
+	TIMSK2 |= (1 << TOIE2);
+
+	// (TCCR2B): TC2 Control Register B, clk/1
+	TCCR2B = (TIMER2_PRESCALER_1 << CS20);
+
+	critical_sei();
+}
+
+/* Stop the Synthesizer and release the Pins */
+void stop_dds()
+{
+	TIMSK2 &= ~(1 << TOIE2);
+	TCCR2A = 0;
+	stop_timer2();
+}
+
+/* Select a built-in Waveform */
+void dds_set_wave(uint8_t channel, uint8_t wave)
+{
+	if(wave <= DDS_WAVE_SQUARE)
+		dds_set_table(channel, g_dds_waves[wave]);
+}
+
+/* Select a 256-byte Waveform Table in Flash */
+void dds_set_table(uint8_t channel, const uint8_t *table)
+{
+	if(channel > DDS_CHANNEL_B)
+		return;
+
+	CRITICAL_BLOCK()
+	{
+		g_dds_channels[channel].table = table;
+	}
+}
+
+/* Set the Frequency in Centihertz */
+void dds_set_frequency(uint8_t channel, uint32_t centihz)
+{
+	dds_set_tuning(channel, DDS_TUNING_CENTIHZ(centihz));
+}
+
+/* 
+ * Set the Tuning Word
+ * The accumulator keeps running, so the change is phase continuous
+ */
+void dds_set_tuning(uint8_t channel, uint32_t tuning)
+{
+	if(channel > DDS_CHANNEL_B)
+		return;
+
+	CRITICAL_BLOCK()
+	{
+		g_dds_channels[channel].tuning = tuning;
+	}
+}
+
+/* Set the Amplitude around mid-scale, 0 - DDS_AMPLITUDE_FULL */
+void dds_set_amplitude(uint8_t channel, uint8_t amplitude)
+{
+	if(channel <= DDS_CHANNEL_B)
+		g_dds_channels[channel].amplitude = amplitude;
+}
+
+/* Move a Channel's Phase, in 1/256 of a period */
+void dds_set_phase(uint8_t channel, uint8_t phase)
+{
+	if(channel > DDS_CHANNEL_B)
+		return;
+
+	CRITICAL_BLOCK()
+	{
+		g_dds_channels[channel].phase = (g_dds_channels[channel].phase & 0x00FFFFFF) | ((uint32_t) phase << 24);
+	}
+}
+
+/* Next Sample of a Channel */
+static inline uint8_t dds_sample(volatile dds_channel_t *channel)
+{
+	uint32_t phase = channel->phase + channel->tuning;
+	channel->phase = phase;
+
+	uint8_t sample = pgm_read_byte(channel->table + (uint8_t) (phase >> 24));
+	uint8_t amplitude = channel->amplitude;
+	
+	if(amplitude == DDS_AMPLITUDE_FULL)
+		return sample;
+	return 0x80 + (int8_t) (((int16_t) (int8_t) (sample - 0x80) * amplitude) >> 8);
+}
+
+/* 
+ * Sample Interrupt
+ * The compare values written here are latched by the hardware at BOTTOM,
+ * so every PWM period carries exactly one sample
+ */
+ISR(TIMER2_OVF_vect)
+{
+	OCR2A = dds_sample(&g_dds_channels[DDS_CHANNEL_A]);
+	OCR2B = dds_sample(&g_dds_channels[DDS_CHANNEL_B]);
+}
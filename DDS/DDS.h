@@ -0,0 +1,72 @@
+/*
+ * dds.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _DDS_H_
+#define _DDS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							DDS Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 2 in Fast PWM Mode at clk/1, one sample per overflow.
+// Outputs: OC2A (PB3) and OC2B (PD3), each followed by an RC low-pass filter.
+// The overflow vector is owned by this module, leave TIMER2_OVF_DISPATCH
+// compiled out.
+#if TIMER2_OVF_DISPATCH
+#error "DDS: TIMER2_OVF is taken by this module, set TIMER2_OVF_DISPATCH to 0"
+#endif
+
+#define DDS_SAMPLE_HZ ((F_CPU) / 256UL)
+
+#define DDS_CHANNEL_A 0
+#define DDS_CHANNEL_B 1
+
+// 256-byte waveform tables in flash
+#define DDS_WAVE_SINE 0
+#define DDS_WAVE_TRIANGLE 1
+#define DDS_WAVE_SAWTOOTH 2
+#define DDS_WAVE_SQUARE 3
+
+#define DDS_AMPLITUDE_FULL 255
+
+// Tuning word of a frequency in centihertz, 2^32 * f / DDS_SAMPLE_HZ
+#define DDS_TUNING_CENTIHZ(centihz) ((uint32_t) (((uint64_t) (centihz) << 32) / (DDS_SAMPLE_HZ * 100ULL)))
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							DDS Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_dds(uint8_t channels);
+void stop_dds();
+void dds_set_wave(uint8_t channel, uint8_t wave);
+void dds_set_table(uint8_t channel, const uint8_t *table);
+void dds_set_frequency(uint8_t channel, uint32_t centihz);
+void dds_set_tuning(uint8_t channel, uint32_t tuning);
+void dds_set_amplitude(uint8_t channel, uint8_t amplitude);
+void dds_set_phase(uint8_t channel, uint8_t phase);
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _DDS_H_ */
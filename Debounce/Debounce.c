@@ -1,72 +1,177 @@
 /*
- * toggle_debounced.c
+ * debounce.c
  *
  * Created: 6/15/2019
- * Author : Miguel Osuna
+ * Author: Miguel Osuna
  */ 
-#ifndef F_CPU
-#define F_CPU 16000000UL
-#endif 
+#include "Debounce.h"
 
-#include <avr/io.h>
-#include <util/delay.h>
+#if DEBOUNCE_SLEEP_WAIT
+#include "Wait.h"
+#endif
 
 /*
  * //////////////////////////////////////////////////////////////////////////
- *							Debounce Definitions
+ *							Debounce Variables
  * //////////////////////////////////////////////////////////////////////////
  */ 
-#define BUTTON_DDR DDRB
-#define BUTTON_PORT PORTB
-#define BUTTON_PIN PINB
-#define BUTTON PB0
-#define LED_DDR DDRB
-#define LED_PORT PORTB
-#define LED PB5
-#define DEBOUNCE_TIME 1000 // Time in microseconds
+// One 2-bit vertical counter per pin, bit n of cnt0/cnt1 count pin n
+typedef struct
+{
+	uint8_t mask;	  // Debounced pins
+	uint8_t state;	  // Debounced level, '1': Pressed
+	uint8_t cnt0;
+	uint8_t cnt1;
+	uint8_t pressed;  // Press edges not read yet
+	uint8_t released; // Release edges not read yet
+} debounce_port_t;
+
+static volatile debounce_port_t g_debounce[3];
 
 /*
  * //////////////////////////////////////////////////////////////////////////
  *							Debounce Functions
  * //////////////////////////////////////////////////////////////////////////
  */ 
-uint8_t debounce()
+
+/* Buttons of a Port, pressed pulls the pin low */
+static inline uint8_t debounce_sample(uint8_t port)
 {
-	/* If push-button is pressed */
-	if(!(BUTTON_PIN & (1 << BUTTON)))
+	switch(port)
 	{
-		_delay_us(DEBOUNCE_TIME);
-		
-		/* If push-button is still pressed */
-		if(!(BUTTON_PIN & (1 << BUTTON)))
-			return 1;
+		case DEBOUNCE_PORT_B: return ~PINB;
+		case DEBOUNCE_PORT_C: return ~PINC;
+		default: return ~PIND;
 	}
-	return 0;
 }
 
-int main(void)
+/* 
+ * Debounce Pins of a Port, as Inputs with Pull-ups
+ * Port '0': Port B, '1': Port C, '2': Port D
+ */
+void init_debounce(uint8_t port, uint8_t mask)
 {
-    /* ----- Inits ----- */
-	LED_DDR |= (1 << LED); // On-board LED as Output
-	BUTTON_DDR &= ~(1 << PB1); // Push-button as Input
-	BUTTON_PORT |= (1 << BUTTON); // Configure as Pull-up Resistor
+	if(port > DEBOUNCE_PORT_D)
+		return;
+
+	CRITICAL_BLOCK()
+	{
+		switch(port)
+		{
+			case DEBOUNCE_PORT_B: DDRB &= ~mask; PORTB |= mask; break;
+			case DEBOUNCE_PORT_C: DDRC &= ~mask; PORTC |= mask; break;
+			default: DDRD &= ~mask; PORTD |= mask; break;
+		}
+
+		volatile debounce_port_t *p = &g_debounce[port];
+		p->mask |= mask;
+		p->cnt0 &= ~mask;
+		p->cnt1 &= ~mask;
+		p->pressed &= ~mask;
+		p->released &= ~mask;
+	}
 	
-	uint8_t button_pressed = 0;
+	// Let the pull-ups settle before taking the start level
+	_delay_us(10);
 	
-    while (1) 
-    {
-		/* If push-button is pressed, toggle LED */
-		if(debounce())
+	CRITICAL_BLOCK()
+	{
+		volatile debounce_port_t *p = &g_debounce[port];
+		p->state = (p->state & ~mask) | (debounce_sample(port) & mask);
+	}
+}
+
+/* 
+ * Sample every Port, timer_callback_t compatible
+ * Each pin whose sample differs from its state counts up, four in a row
+ * toggle it, all pins of a port in parallel
+ */
+void debounce_tick(void *ctx)
+{
+	for(uint8_t port = 0; port < 3; port++)
+	{
+		volatile debounce_port_t *p = &g_debounce[port];
+		if(!p->mask)
+			continue;
+
+		uint8_t state = p->state;
+		uint8_t cnt0 = p->cnt0;
+		uint8_t delta = (debounce_sample(port) ^ state) & p->mask;
+		
+		// Counters of unchanged pins go back to zero
+		uint8_t cnt1 = (p->cnt1 ^ cnt0) & delta;
+		cnt0 = ~cnt0 & delta;
+
+		uint8_t toggle = delta & ~(cnt0 | cnt1);
+		state ^= toggle;
+		
+		p->cnt0 = cnt0;
+		p->cnt1 = cnt1;
+		p->state = state;
+		p->pressed |= toggle & state;
+		p->released |= toggle & ~state;
+	}
+}
+
+/* Debounced Level, '1': Pressed */
+uint8_t debounce_state(uint8_t port)
+{
+	return (port <= DEBOUNCE_PORT_D) ? g_debounce[port].state : 0;
+}
+
+/* Pins Pressed since the last call */
+uint8_t debounce_pressed(uint8_t port)
+{
+	uint8_t pressed = 0;
+
+	if(port <= DEBOUNCE_PORT_D)
+	{
+		CRITICAL_BLOCK()
+		{
+			pressed = g_debounce[port].pressed;
+			g_debounce[port].pressed = 0;
+		}
+	}
+	return pressed;
+}
+
+/* Pins Released since the last call */
+uint8_t debounce_released(uint8_t port)
+{
+	uint8_t released = 0;
+
+	if(port <= DEBOUNCE_PORT_D)
+	{
+		CRITICAL_BLOCK()
 		{
-			if(!button_pressed)
-			{
-				LED_PORT ^= (1 << LED);
-				button_pressed = 1;
-			}
+			released = g_debounce[port].released;
+			g_debounce[port].released = 0;
 		}
-		else
-			button_pressed = 0;
 	}
-	return 0;
+	return released;
 }
 
+/* 
+ * Block until one of the mask Pins is Pressed, returns and clears those
+ * press edges. debounce_tick() must keep running from a timer interrupt.
+ */
+uint8_t debounce_wait_pressed(uint8_t port, uint8_t mask)
+{
+	uint8_t pressed = 0;
+
+	if(port > DEBOUNCE_PORT_D || !(g_debounce[port].mask & mask))
+		return 0;
+
+#if DEBOUNCE_SLEEP_WAIT
+	WAIT_UNTIL(SLEEP_MODE_IDLE, g_debounce[port].pressed & mask);
+#else
+	while(!(g_debounce[port].pressed & mask));
+#endif
+
+	CRITICAL_BLOCK()
+	{
+		pressed = g_debounce[port].pressed & mask;
+		g_debounce[port].pressed &= ~pressed;
+	}
+	return pressed;
+}
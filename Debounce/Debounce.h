@@ -0,0 +1,57 @@
+/*
+ * debounce.h
+ *
+ * Created: 6/15/2019
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _DEBOUNCE_H_
+#define _DEBOUNCE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <util/delay.h>
+#include "Critical.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Debounce Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// debounce_tick() samples every enabled pin, a change is accepted after
+// four equal samples (4 ms from a 1 ms tick). Call it from one timer tick
+// callback, e.g. TIMER0_COMPB with init_millis() running.
+#define DEBOUNCE_PORT_B 0
+#define DEBOUNCE_PORT_C 1
+#define DEBOUNCE_PORT_D 2
+
+// Set DEBOUNCE_SLEEP_WAIT to 1 project-wide to idle-sleep between ticks in
+// debounce_wait_pressed() instead of polling, the tick timer wakes the CPU
+#ifndef DEBOUNCE_SLEEP_WAIT
+#define DEBOUNCE_SLEEP_WAIT 0
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Debounce Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_debounce(uint8_t port, uint8_t mask);
+void debounce_tick(void *ctx);
+uint8_t debounce_state(uint8_t port);
+uint8_t debounce_pressed(uint8_t port);
+uint8_t debounce_released(uint8_t port);
+uint8_t debounce_wait_pressed(uint8_t port, uint8_t mask);
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _DEBOUNCE_H_ */
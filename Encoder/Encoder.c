@@ -0,0 +1,277 @@
+/*
+ * encoder.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Encoder.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Encoder Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define ENCODER_ILLEGAL 2 // Both channels changed, a transition was missed
+
+/* 
+ * Count of a Transition, indexed by (old AB << 2) | new AB
+ * Forward runs 00 -> 10 -> 11 -> 01 -> 00 (A leads B)
+ */
+static const int8_t g_encoder_tables[3][16] =
+{
+	// X1: A rising with B low, and its reverse
+	{ 0, 0, 1, ENCODER_ILLEGAL, 0, 0, ENCODER_ILLEGAL, 0, -1, ENCODER_ILLEGAL, 0, 0, ENCODER_ILLEGAL, 0, 0, 0 },
+	// X2: Every A edge
+	{ 0, 0, 1, ENCODER_ILLEGAL, 0, 0, ENCODER_ILLEGAL, -1, -1, ENCODER_ILLEGAL, 0, 0, ENCODER_ILLEGAL, 1, 0, 0 },
+	// X4: Every edge
+	{ 0, -1, 1, ENCODER_ILLEGAL, 1, 0, ENCODER_ILLEGAL, -1, -1, ENCODER_ILLEGAL, 0, 1, ENCODER_ILLEGAL, 1, -1, 0 }
+};
+
+typedef struct
+{
+	const int8_t *table;
+	volatile uint8_t *pins; // Input register, PCINT encoders
+	uint8_t mask_a;
+	uint8_t mask_b;
+	uint8_t state;			// Last AB
+	volatile int32_t position;
+	volatile uint32_t edge_us; // Time of the last counted edge
+	volatile uint16_t errors;
+
+	// Velocity sampling, main context only
+	int32_t sample_position;
+	uint32_t sample_us;
+	int32_t velocity;
+} encoder_t;
+
+static encoder_t g_encoders[ENCODER_MAX];
+static uint8_t g_encoder_count;
+
+#if ENCODER_EXTERNAL_INTERRUPTS
+static encoder_t *gp_encoder_int; // Encoder on INT0/INT1
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Encoder Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Current AB of an Encoder, A on bit 1 and B on bit 0 */
+static inline uint8_t encoder_read(const encoder_t *encoder, uint8_t pins)
+{
+	return ((pins & encoder->mask_a) ? 2 : 0) | ((pins & encoder->mask_b) ? 1 : 0);
+}
+
+/* Table-driven State Machine Step */
+static inline void encoder_update(encoder_t *encoder, uint8_t ab)
+{
+	int8_t delta = encoder->table[(encoder->state << 2) | ab];
+	encoder->state = ab;
+
+	if(delta == ENCODER_ILLEGAL)
+		encoder->errors++;
+	else if(delta)
+	{
+		encoder->position += delta;
+		encoder->edge_us = micros();
+	}
+}
+
+/* Claim and Initialize an Encoder Slot */
+static encoder_t *encoder_new(uint8_t mode, volatile uint8_t *pins, uint8_t mask_a, uint8_t mask_b)
+{
+	if(g_encoder_count >= ENCODER_MAX || mode > ENCODER_MODE_X4)
+		return 0;
+
+	encoder_t *encoder = &g_encoders[g_encoder_count++];
+	encoder->table = g_encoder_tables[mode];
+	encoder->pins = pins;
+	encoder->mask_a = mask_a;
+	encoder->mask_b = mask_b;
+	encoder->state = encoder_read(encoder, *pins);
+	encoder->position = 0;
+	encoder->errors = 0;
+	encoder->edge_us = micros();
+	encoder->sample_position = 0;
+	encoder->sample_us = encoder->edge_us;
+	encoder->velocity = 0;
+	return encoder;
+}
+
+/* 
+ * Attach an Encoder to INT0 (PD2, A) and INT1 (PD3, B)
+ * Returns its id, or ENCODER_NO_ENCODER
+ */
+uint8_t encoder_attach_int(uint8_t mode)
+{
+#if ENCODER_EXTERNAL_INTERRUPTS
+	if(gp_encoder_int)
+		return ENCODER_NO_ENCODER;
+
+	// Inputs with Pull-ups
+	DDRD &= ~((1 << DDD2) | (1 << DDD3));
+	PORTD |= (1 << PORTD2) | (1 << PORTD3);
+
+	encoder_t *encoder = encoder_new(mode, &PIND, (1 << PIND2), (1 << PIND3));
+	if(!encoder)
+		return ENCODER_NO_ENCODER;
+
+	CRITICAL_BLOCK()
+	{
+		gp_encoder_int = encoder;
+		
+		// Clear stale flags (Writing a logic one to the flag clears it)
+		EIFR = (1 << INTF0) | (1 << INTF1);
+	}
+	enable_interrupt(EXTERNAL_INTERRUPT_REQUEST_0, INTERRUPT_MODE_LOGICAL_CHANGE);
+	enable_interrupt(EXTERNAL_INTERRUPT_REQUEST_1, INTERRUPT_MODE_LOGICAL_CHANGE);
+	
+	return encoder - g_encoders;
+#else
+	return ENCODER_NO_ENCODER;
+#endif
+}
+
+/* Pin Change Callback, ctx is the encoder */
+static void encoder_pcint(uint8_t edge, void *ctx)
+{
+	encoder_t *encoder = (encoder_t *) ctx;
+	encoder_update(encoder, encoder_read(encoder, *encoder->pins));
+}
+
+/* 
+ * Attach an Encoder to two Pins of one Port
+ * Port '0': Port B, '1': Port C, '2': Port D
+ * Returns its id, or ENCODER_NO_ENCODER if no slot is free or the port is
+ * compiled out of the pin change dispatcher
+ */
+uint8_t encoder_attach_pcint(uint8_t port, uint8_t pin_a, uint8_t pin_b, uint8_t mode)
+{
+	volatile uint8_t *pins, *ddr, *out;
+
+	if(port > PIN_CHANGE_INTERRUPT_2 || pin_a > 7 || pin_b > 7)
+		return ENCODER_NO_ENCODER;
+
+	switch(port)
+	{
+		case PIN_CHANGE_INTERRUPT_1: pins = &PINC; ddr = &DDRC; out = &PORTC; break;
+		case PIN_CHANGE_INTERRUPT_2: pins = &PIND; ddr = &DDRD; out = &PORTD; break;
+		default: pins = &PINB; ddr = &DDRB; out = &PORTB; break;
+	}
+
+	uint8_t mask_a = (1 << pin_a);
+	uint8_t mask_b = (1 << pin_b);
+
+	// Inputs with Pull-ups
+	CRITICAL_BLOCK()
+	{
+		*ddr &= ~(mask_a | mask_b);
+		*out |= mask_a | mask_b;
+	}
+
+	encoder_t *encoder = encoder_new(mode, pins, mask_a, mask_b);
+	if(!encoder)
+		return ENCODER_NO_ENCODER;
+
+	if(!pcint_attach(port, pin_a, encoder_pcint, encoder) || !pcint_attach(port, pin_b, encoder_pcint, encoder))
+	{
+		pcint_detach(port, pin_a);
+		g_encoder_count--;
+		return ENCODER_NO_ENCODER;
+	}
+	return encoder - g_encoders;
+}
+
+/* Position in Counts */
+int32_t encoder_position(uint8_t id)
+{
+	int32_t position = 0;
+
+	if(id < g_encoder_count)
+	{
+		CRITICAL_BLOCK()
+		{
+			position = g_encoders[id].position;
+		}
+	}
+	return position;
+}
+
+/* Set the Position, e.g. to zero it at a home switch */
+void encoder_set_position(uint8_t id, int32_t position)
+{
+	if(id >= g_encoder_count)
+		return;
+
+	encoder_t *encoder = &g_encoders[id];
+	CRITICAL_BLOCK()
+	{
+		encoder->position = position;
+	}
+	encoder->sample_position = position;
+}
+
+/* 
+ * Velocity in Counts per Second
+ * The counts since the last call are divided by the time between the
+ * edges that bound them, so the estimate holds at low and high speed.
+ * Call it periodically.
+ */
+int32_t encoder_velocity(uint8_t id)
+{
+	int32_t position;
+	uint32_t edge_us;
+
+	if(id >= g_encoder_count)
+		return 0;
+
+	encoder_t *encoder = &g_encoders[id];
+	CRITICAL_BLOCK()
+	{
+		position = encoder->position;
+		edge_us = encoder->edge_us;
+	}
+
+	int32_t counts = position - encoder->sample_position;
+	if(counts)
+	{
+		uint32_t dt = edge_us - encoder->sample_us;
+		if(dt)
+			encoder->velocity = (int32_t) (((int64_t) counts * 1000000L) / (int32_t) dt);
+		encoder->sample_position = position;
+		encoder->sample_us = edge_us;
+	}
+	else if((uint32_t) (micros() - encoder->sample_us) > ENCODER_STOP_US)
+		encoder->velocity = 0;
+
+	return encoder->velocity;
+}
+
+/* Illegal Transitions seen, each means at least one missed edge */
+uint16_t encoder_errors(uint8_t id)
+{
+	uint16_t errors = 0;
+
+	if(id < g_encoder_count)
+	{
+		CRITICAL_BLOCK()
+		{
+			errors = g_encoders[id].errors;
+		}
+	}
+	return errors;
+}
+
+/* External Interrupts, channel A on INT0 and B on INT1 */
+#if ENCODER_EXTERNAL_INTERRUPTS
+ISR(INT0_vect)
+{
+	encoder_update(gp_encoder_int, encoder_read(gp_encoder_int, PIND));
+}
+
+ISR(INT1_vect)
+{
+	encoder_update(gp_encoder_int, encoder_read(gp_encoder_int, PIND));
+}
+#endif
@@ -0,0 +1,75 @@
+/*
+ * encoder.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _ENCODER_H_
+#define _ENCODER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Critical.h"
+#include "Interrupt.h"
+#include "Millis.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Encoder Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Encoders on pin change pins go through the pin change dispatcher, their
+// port needs PCINTn_DISPATCH set. One encoder can take INT0 (PD2, A) and
+// INT1 (PD3, B) for the highest rate, those vectors are owned by this module
+// unless ENCODER_EXTERNAL_INTERRUPTS is set to 0.
+// Edge timestamps come from micros(), init_millis() must be running.
+#ifndef ENCODER_MAX
+#define ENCODER_MAX 4
+#endif
+
+#ifndef ENCODER_EXTERNAL_INTERRUPTS
+#define ENCODER_EXTERNAL_INTERRUPTS 1
+#endif
+
+#if ENCODER_EXTERNAL_INTERRUPTS && (INT0_DISPATCH || INT1_DISPATCH)
+#error "Encoder: INT0/INT1 are taken by the dispatcher, set ENCODER_EXTERNAL_INTERRUPTS to 0"
+#endif
+
+// Counts per quadrature cycle
+#define ENCODER_MODE_X1 0
+#define ENCODER_MODE_X2 1
+#define ENCODER_MODE_X4 2
+
+// Without edges for this long the velocity reads zero
+#ifndef ENCODER_STOP_US
+#define ENCODER_STOP_US 100000UL
+#endif
+
+#define ENCODER_NO_ENCODER 0xFF
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Encoder Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+uint8_t encoder_attach_int(uint8_t mode);
+uint8_t encoder_attach_pcint(uint8_t port, uint8_t pin_a, uint8_t pin_b, uint8_t mode);
+int32_t encoder_position(uint8_t id);
+void encoder_set_position(uint8_t id, int32_t position);
+int32_t encoder_velocity(uint8_t id);
+uint16_t encoder_errors(uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _ENCODER_H_ */
@@ -0,0 +1,109 @@
+/*
+ * event.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Event.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Event Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Keeps the compiler from moving slot accesses across an index update
+#define EVENT_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
+typedef struct
+{
+	event_handler_t handler;
+	void *ctx;
+	uint8_t arg;
+} event_t;
+
+static event_t g_event_queue[EVENT_QUEUE_SIZE];
+static volatile uint8_t g_event_head; // Written by the producer only
+static volatile uint8_t g_event_tail; // Written by the consumer only
+static volatile uint16_t g_event_dropped;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Event Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Queue an Event, call it from interrupt context
+ * Single-byte indices are written atomically, so no interrupt is disabled.
+ * Returns '0' and counts a drop if the queue is full
+ */
+uint8_t event_post(event_handler_t handler, uint8_t arg, void *ctx)
+{
+	uint8_t head = g_event_head;
+	uint8_t next = (head + 1) & (EVENT_QUEUE_SIZE - 1);
+
+	if(next == g_event_tail)
+	{
+		g_event_dropped++;
+		return 0;
+	}
+
+	event_t *event = &g_event_queue[head];
+	event->handler = handler;
+	event->arg = arg;
+	event->ctx = ctx;
+
+	// Publish the slot only once it is complete
+	EVENT_BARRIER();
+	g_event_head = next;
+	return 1;
+}
+
+/* 
+ * Run the Events Queued so far in Order, call it from the main loop
+ * Events posted meanwhile wait for the next call, so it always returns.
+ * Returns the number of events run
+ */
+uint8_t event_dispatch()
+{
+	uint8_t count = 0;
+	uint8_t tail = g_event_tail;
+	uint8_t head = g_event_head;
+
+	while(tail != head)
+	{
+		EVENT_BARRIER();
+		event_t *event = &g_event_queue[tail];
+		event_handler_t handler = event->handler;
+		uint8_t arg = event->arg;
+		void *ctx = event->ctx;
+
+		// Release the slot before running, the handler may take long
+		EVENT_BARRIER();
+		tail = (tail + 1) & (EVENT_QUEUE_SIZE - 1);
+		g_event_tail = tail;
+
+		if(handler)
+			handler(arg, ctx);
+		count++;
+	}
+	return count;
+}
+
+/* Events waiting to be dispatched */
+uint8_t event_pending()
+{
+	return (g_event_head - g_event_tail) & (EVENT_QUEUE_SIZE - 1);
+}
+
+/* Events lost to a full queue */
+uint16_t event_dropped()
+{
+	uint16_t dropped;
+	
+	CRITICAL_BLOCK()
+	{
+		dropped = g_event_dropped;
+	}
+	return dropped;
+}
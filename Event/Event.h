@@ -0,0 +1,55 @@
+/*
+ * event.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _EVENT_H_
+#define _EVENT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include "Critical.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Event Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Interrupts post, the main loop dispatches. AVR interrupts do not nest, so
+// all of them together act as the single producer; handlers declared with
+// ISR_NOBLOCK must not post.
+#ifndef EVENT_QUEUE_SIZE
+#define EVENT_QUEUE_SIZE 16
+#endif
+
+#if (EVENT_QUEUE_SIZE & (EVENT_QUEUE_SIZE - 1)) != 0 || EVENT_QUEUE_SIZE > 128
+#error "Event: EVENT_QUEUE_SIZE must be a power of two up to 128"
+#endif
+
+// Handler run from the main loop, arg and ctx are the ones posted
+typedef void (*event_handler_t)(uint8_t arg, void *ctx);
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Event Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+uint8_t event_post(event_handler_t handler, uint8_t arg, void *ctx);
+uint8_t event_dispatch();
+uint8_t event_pending();
+uint16_t event_dropped();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _EVENT_H_ */
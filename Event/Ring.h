@@ -0,0 +1,98 @@
+/*
+ * ring.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _RING_H_
+#define _RING_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Ring Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Single-producer, single-consumer byte queue, e.g. a timer tick posting
+// and the main loop reading. Each side writes its own single-byte index,
+// so neither disables interrupts. One slot stays empty:
+//	static uint8_t g_queue_buffer[16];
+//	static ring_t g_queue = RING_INIT(g_queue_buffer);
+
+// Keeps the compiler from moving slot accesses across an index update
+#define RING_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
+// Ring over a static array, its size a power of two up to 256
+#define RING_INIT(buffer) { (buffer), (uint8_t) (sizeof(buffer) - 1), 0, 0 }
+
+typedef struct
+{
+	uint8_t *buffer;
+	uint8_t mask;		   // Size - 1
+	volatile uint8_t head; // Written by the producer only
+	volatile uint8_t tail; // Written by the consumer only
+} ring_t;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Ring Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Queue a Byte, producer side
+ * Returns '0' if the ring is full, the byte is dropped
+ */
+static inline uint8_t ring_put(ring_t *ring, uint8_t data)
+{
+	uint8_t head = ring->head;
+	uint8_t next = (head + 1) & ring->mask;
+
+	if(next == ring->tail)
+		return 0;
+
+	ring->buffer[head] = data;
+
+	// Publish the slot only once it is written
+	RING_BARRIER();
+	ring->head = next;
+	return 1;
+}
+
+/* 
+ * Take the Oldest Byte, consumer side
+ * Returns '0' if the ring is empty
+ */
+static inline uint8_t ring_get(ring_t *ring, uint8_t *data)
+{
+	uint8_t tail = ring->tail;
+
+	if(tail == ring->head)
+		return 0;
+
+	RING_BARRIER();
+	*data = ring->buffer[tail];
+
+	// Release the slot only once it is read
+	RING_BARRIER();
+	ring->tail = (tail + 1) & ring->mask;
+	return 1;
+}
+
+/* Bytes waiting */
+static inline uint8_t ring_count(const ring_t *ring)
+{
+	return (ring->head - ring->tail) & ring->mask;
+}
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _RING_H_ */
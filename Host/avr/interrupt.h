@@ -0,0 +1,43 @@
+/*
+ * interrupt.h (host)
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ *
+ * Host stand-in for <avr/interrupt.h>. ISR() defines a global handler and
+ * registers it in the simulated vector table before main() runs, so two
+ * modules claiming the same vector fail to link exactly as with avr-gcc.
+ */
+#pragma once
+#ifndef _HOST_AVR_INTERRUPT_H_
+#define _HOST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void host_register_isr(uint8_t vector, void (*handler)(void));
+
+#define sei() (SREG |= (1 << SREG_I))
+#define cli() (SREG &= (uint8_t) ~(1 << SREG_I))
+#define reti() return
+
+#define ISR_BLOCK
+#define ISR_NOBLOCK
+#define ISR_NAKED
+
+#define ISR(vector, ...) \
+	void vector##_handler(void); \
+	__attribute__((constructor)) static void vector##_install(void) \
+	{ host_register_isr(vector##_num, vector##_handler); } \
+	void vector##_handler(void)
+
+#define EMPTY_INTERRUPT(vector) ISR(vector) { }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,28 @@
+/*
+ * pgmspace.h (host)
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ *
+ * Host stand-in for <avr/pgmspace.h>: flash and RAM share one address space.
+ */
+#pragma once
+#ifndef _HOST_AVR_PGMSPACE_H_
+#define _HOST_AVR_PGMSPACE_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr) (*(const uint8_t *) (addr))
+#define pgm_read_word(addr) (*(const uint16_t *) (addr))
+#define pgm_read_dword(addr) (*(const uint32_t *) (addr))
+#define pgm_read_ptr(addr) (*(void * const *) (addr))
+
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+#endif /* _HOST_AVR_PGMSPACE_H_ */
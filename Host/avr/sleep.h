@@ -0,0 +1,40 @@
+/*
+ * sleep.h (host)
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ *
+ * Host stand-in for <avr/sleep.h>. sleep_cpu() fast-forwards the simulated
+ * clock to the next enabled interrupt allowed by the selected sleep mode.
+ */
+#pragma once
+#ifndef _HOST_AVR_SLEEP_H_
+#define _HOST_AVR_SLEEP_H_
+
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void host_sleep(void);
+
+#define SLEEP_MODE_IDLE (0)
+#define SLEEP_MODE_ADC (1 << SM0)
+#define SLEEP_MODE_PWR_DOWN (1 << SM1)
+#define SLEEP_MODE_PWR_SAVE ((1 << SM0) | (1 << SM1))
+#define SLEEP_MODE_STANDBY ((1 << SM1) | (1 << SM2))
+#define SLEEP_MODE_EXT_STANDBY ((1 << SM0) | (1 << SM1) | (1 << SM2))
+
+#define set_sleep_mode(mode) (SMCR = (uint8_t) ((SMCR & ~((1 << SM0) | (1 << SM1) | (1 << SM2))) | (mode)))
+#define sleep_enable() (SMCR |= (1 << SE))
+#define sleep_disable() (SMCR &= (uint8_t) ~(1 << SE))
+#define sleep_cpu() host_sleep()
+#define sleep_mode() do { sleep_enable(); sleep_cpu(); sleep_disable(); } while(0)
+#define sleep_bod_disable() do { } while(0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HOST_AVR_SLEEP_H_ */
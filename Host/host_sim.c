@@ -0,0 +1,943 @@
+/*
+ * host_sim.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <util/delay.h>
+
+#include "host_sim.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Host Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+#define HOST_MEM_SIZE 0x100
+#define HOST_NONE 0xFFFF
+
+// Cycles simulated between interrupt checks while delaying or sleeping
+#define HOST_STEP 8
+
+// Cycles charged for interrupt entry and RETI
+#define HOST_ISR_CYCLES 4
+
+// Register Addresses (data space)
+#define IO_PINB 0x23
+#define IO_PIND 0x29
+#define IO_TIFR0 0x35
+#define IO_TIFR1 0x36
+#define IO_TIFR2 0x37
+#define IO_PCIFR 0x3B
+#define IO_EIFR 0x3C
+#define IO_EIMSK 0x3D
+#define IO_TCCR0A 0x44
+#define IO_TCCR0B 0x45
+#define IO_TCNT0 0x46
+#define IO_OCR0A 0x47
+#define IO_OCR0B 0x48
+#define IO_SMCR 0x53
+#define IO_SREG 0x5F
+#define IO_PRR 0x64
+#define IO_PCICR 0x68
+#define IO_EICRA 0x69
+#define IO_PCMSK0 0x6B
+#define IO_TIMSK0 0x6E
+#define IO_TIMSK1 0x6F
+#define IO_TIMSK2 0x70
+#define IO_ADCL 0x78
+#define IO_ADCH 0x79
+#define IO_ADCSRA 0x7A
+#define IO_ADCSRB 0x7B
+#define IO_ADMUX 0x7C
+#define IO_TCCR1A 0x80
+#define IO_TCCR1B 0x81
+#define IO_TCNT1 0x84
+#define IO_ICR1 0x86
+#define IO_OCR1A 0x88
+#define IO_OCR1B 0x8A
+#define IO_TCCR2A 0xB0
+#define IO_TCCR2B 0xB1
+#define IO_TCNT2 0xB2
+#define IO_OCR2A 0xB3
+#define IO_OCR2B 0xB4
+#define IO_ASSR 0xB6
+#define IO_UCSR0A 0xC0
+#define IO_UCSR0B 0xC1
+#define IO_UCSR0C 0xC2
+#define IO_UBRR0 0xC4
+#define IO_UDR0 0xC6
+
+#define HOST_REG(addr) g_host_mem[addr]
+#define HOST_REG16(addr) ((uint16_t) (g_host_mem[addr] | (g_host_mem[(addr) + 1] << 8)))
+#define HOST_SET16(addr, value) do { \
+	g_host_mem[addr] = (uint8_t) (value); \
+	g_host_mem[(addr) + 1] = (uint8_t) ((value) >> 8); \
+} while(0)
+
+// Sleep modes (SMCR SM2:0)
+#define HOST_SLEEP_MODE(smcr) (((smcr) >> SM0) & 0x07)
+#define HOST_MODE_IDLE 0
+#define HOST_MODE_ADC 1
+#define HOST_MODE_PWR_SAVE 3
+#define HOST_MODE_EXT_STANDBY 7
+
+// Interrupt source, in vector priority order
+typedef struct
+{
+	uint8_t vector;
+	uint8_t mask_addr;		// Enable bit location
+	uint8_t mask_bit;
+	uint8_t flag_addr;		// Flag bit location
+	uint8_t flag_bit;
+	uint8_t clear;			// Hardware clears the flag on entry
+} host_source_t;
+
+// Timer model state
+typedef struct
+{
+	uint64_t acc;			// Clock accumulated toward the next count
+	uint8_t down;			// Phase correct counting direction
+} host_timer_t;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Host Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */
+static uint8_t g_host_mem[HOST_MEM_SIZE] __attribute__((aligned(2)));
+
+// Access handed out and not yet committed
+static uint16_t g_host_pending = HOST_NONE;
+static uint8_t g_host_pending_size;
+static uint8_t g_host_shadow[2];
+
+static uint64_t g_host_cycles;
+static void (*gp_host_vectors[_VECTORS_SIZE])(void);
+static uint32_t g_host_serviced;
+static uint16_t g_host_bad;
+static uint8_t g_host_sleep_mode;
+static uint8_t g_host_sleeping;
+
+// Timers: clk/N prescaler dividers per CS bits (0 = stopped or external)
+static host_timer_t g_host_timer[3];
+static const uint16_t g_host_div01[8] = {0, 1, 8, 64, 256, 1024, 0, 0};
+static const uint16_t g_host_div2[8] = {0, 1, 8, 32, 64, 128, 256, 1024};
+
+// Ports: external levels and the last PINx value seen
+static uint8_t g_host_level[3];
+static uint8_t g_host_pin_last[3];
+static const uint8_t g_host_pin_mask[3] = {0xFF, 0x7F, 0xFF};
+
+// ADC
+static uint16_t g_host_adc_value[16];
+static uint64_t g_host_adc_done;
+static uint8_t g_host_adc_busy;
+static uint8_t g_host_adc_first;
+
+// USART0
+static uint8_t g_host_rx[HOST_USART_BUFFER];
+static uint16_t g_host_rx_head;
+static uint16_t g_host_rx_count;
+static uint8_t g_host_rx_data;
+static uint8_t g_host_tx[HOST_USART_BUFFER];
+static uint16_t g_host_tx_count;
+static uint8_t g_host_tx_busy;
+static uint8_t g_host_tx_queued;
+static uint8_t g_host_tx_next;
+static uint64_t g_host_tx_done;
+
+static const host_source_t g_host_sources[] =
+{
+	{PCINT0_vect_num, IO_PCICR, PCIE0, IO_PCIFR, PCIF0, 1},
+	{PCINT1_vect_num, IO_PCICR, PCIE1, IO_PCIFR, PCIF1, 1},
+	{PCINT2_vect_num, IO_PCICR, PCIE2, IO_PCIFR, PCIF2, 1},
+	{TIMER2_COMPA_vect_num, IO_TIMSK2, OCIE2A, IO_TIFR2, OCF2A, 1},
+	{TIMER2_COMPB_vect_num, IO_TIMSK2, OCIE2B, IO_TIFR2, OCF2B, 1},
+	{TIMER2_OVF_vect_num, IO_TIMSK2, TOIE2, IO_TIFR2, TOV2, 1},
+	{TIMER1_CAPT_vect_num, IO_TIMSK1, ICIE1, IO_TIFR1, ICF1, 1},
+	{TIMER1_COMPA_vect_num, IO_TIMSK1, OCIE1A, IO_TIFR1, OCF1A, 1},
+	{TIMER1_COMPB_vect_num, IO_TIMSK1, OCIE1B, IO_TIFR1, OCF1B, 1},
+	{TIMER1_OVF_vect_num, IO_TIMSK1, TOIE1, IO_TIFR1, TOV1, 1},
+	{TIMER0_COMPA_vect_num, IO_TIMSK0, OCIE0A, IO_TIFR0, OCF0A, 1},
+	{TIMER0_COMPB_vect_num, IO_TIMSK0, OCIE0B, IO_TIFR0, OCF0B, 1},
+	{TIMER0_OVF_vect_num, IO_TIMSK0, TOIE0, IO_TIFR0, TOV0, 1},
+	{USART_RX_vect_num, IO_UCSR0B, RXCIE0, IO_UCSR0A, RXC0, 0},
+	{USART_UDRE_vect_num, IO_UCSR0B, UDRIE0, IO_UCSR0A, UDRE0, 0},
+	{USART_TX_vect_num, IO_UCSR0B, TXCIE0, IO_UCSR0A, TXC0, 1},
+	{ADC_vect_num, IO_ADCSRA, ADIE, IO_ADCSRA, ADIF, 1},
+};
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Peripheral Models
+ * //////////////////////////////////////////////////////////////////////////
+ */
+
+// True when the active sleep mode keeps clkIO (Timers 0/1, ADC, USART) running
+static uint8_t host_clk_io(void)
+{
+	return !g_host_sleeping || g_host_sleep_mode == HOST_MODE_IDLE || g_host_sleep_mode == HOST_MODE_ADC;
+}
+
+// One count of Timer 0 or Timer 2 (same register layout at different bases)
+static void host_count8(uint8_t base, uint8_t tifr, host_timer_t *p_timer)
+{
+	uint8_t wgm = (HOST_REG(base) & 0x03) | ((HOST_REG(base + 1) >> 1) & 0x04);
+	uint8_t top = (wgm == 2 || (wgm & 0x04)) ? HOST_REG(base + 3) : 0xFF;
+	uint8_t cnt = HOST_REG(base + 2);
+	uint8_t flags = 0;
+
+	if(wgm == 1 || wgm == 5)		// Phase correct: up to TOP, down to BOTTOM
+	{
+		if(p_timer->down)
+		{
+			if(--cnt == 0)
+			{
+				p_timer->down = 0;
+				flags |= (1 << TOV0);
+			}
+		}
+		else if(++cnt >= top)
+			p_timer->down = 1;
+	}
+	else if(cnt == top || cnt == 0xFF)	// Normal, CTC and fast PWM wrap
+	{
+		if(cnt == 0xFF || wgm != 2)	// CTC only overflows at MAX
+			flags |= (1 << TOV0);
+		cnt = 0;
+	}
+	else
+		cnt++;
+
+	if(cnt == HOST_REG(base + 3))
+		flags |= (1 << OCF0A);
+	if(cnt == HOST_REG(base + 4))
+		flags |= (1 << OCF0B);
+
+	HOST_REG(base + 2) = cnt;
+	HOST_REG(tifr) |= flags;
+}
+
+// One count of Timer 1
+static void host_count16(void)
+{
+	uint8_t wgm = (HOST_REG(IO_TCCR1A) & 0x03) | ((HOST_REG(IO_TCCR1B) >> 1) & 0x0C);
+	uint16_t cnt = HOST_REG16(IO_TCNT1);
+	uint16_t top;
+	uint8_t flags = 0;
+
+	switch(wgm)
+	{
+		case 1: case 5: top = 0x00FF; break;
+		case 2: case 6: top = 0x01FF; break;
+		case 3: case 7: top = 0x03FF; break;
+		case 4: case 9: case 11: case 15: top = HOST_REG16(IO_OCR1A); break;
+		case 8: case 10: case 12: case 14: top = HOST_REG16(IO_ICR1); break;
+		default: top = 0xFFFF; break;
+	}
+
+	if((wgm >= 1 && wgm <= 3) || (wgm >= 8 && wgm <= 11))	// Phase (and frequency) correct
+	{
+		if(g_host_timer[1].down)
+		{
+			if(--cnt == 0)
+			{
+				g_host_timer[1].down = 0;
+				flags |= (1 << TOV1);
+			}
+		}
+		else if(++cnt >= top)
+		{
+			g_host_timer[1].down = 1;
+			if(wgm == 8 || wgm == 10)
+				flags |= (1 << ICF1);
+		}
+	}
+	else if(cnt == top || cnt == 0xFFFF)
+	{
+		if(cnt == 0xFFFF || (wgm != 4 && wgm != 12))	// CTC only overflows at MAX
+			flags |= (1 << TOV1);
+		if(cnt == top && (wgm == 12 || wgm == 14))		// ICR1 as TOP sets ICF1
+			flags |= (1 << ICF1);
+		cnt = 0;
+	}
+	else
+		cnt++;
+
+	if(cnt == HOST_REG16(IO_OCR1A))
+		flags |= (1 << OCF1A);
+	if(cnt == HOST_REG16(IO_OCR1B))
+		flags |= (1 << OCF1B);
+
+	HOST_SET16(IO_TCNT1, cnt);
+	HOST_REG(IO_TIFR1) |= flags;
+}
+
+static void host_timers(uint32_t cycles)
+{
+	uint16_t div;
+	uint8_t async;
+	uint64_t unit;
+
+	// Timer 0 and Timer 1 run from clkIO
+	if(host_clk_io())
+	{
+		div = g_host_div01[HOST_REG(IO_TCCR0B) & 0x07];
+		if(div && !(HOST_REG(IO_PRR) & (1 << PRTIM0)))
+			for(g_host_timer[0].acc += cycles; g_host_timer[0].acc >= div; g_host_timer[0].acc -= div)
+				host_count8(IO_TCCR0A, IO_TIFR0, &g_host_timer[0]);
+
+		div = g_host_div01[HOST_REG(IO_TCCR1B) & 0x07];
+		if(div && !(HOST_REG(IO_PRR) & (1 << PRTIM1)))
+			for(g_host_timer[1].acc += cycles; g_host_timer[1].acc >= div; g_host_timer[1].acc -= div)
+				host_count16();
+	}
+
+	// Timer 2 runs from clkIO or, with AS2, from the 32.768 kHz crystal (also in power-save)
+	async = (HOST_REG(IO_ASSR) & (1 << AS2)) != 0;
+	div = g_host_div2[HOST_REG(IO_TCCR2B) & 0x07];
+	if(!div || (HOST_REG(IO_PRR) & (1 << PRTIM2)))
+		return;
+	if(!host_clk_io() && !(async && (g_host_sleep_mode == HOST_MODE_PWR_SAVE || g_host_sleep_mode == HOST_MODE_EXT_STANDBY)))
+		return;
+
+	unit = async ? (uint64_t) div * F_CPU : div;
+	for(g_host_timer[2].acc += async ? (uint64_t) cycles * 32768UL : cycles; g_host_timer[2].acc >= unit; g_host_timer[2].acc -= unit)
+		host_count8(IO_TCCR2A, IO_TIFR2, &g_host_timer[2]);
+}
+
+static void host_adc_start(void)
+{
+	uint16_t div = 1 << (HOST_REG(IO_ADCSRA) & 0x07);
+
+	if(div < 2)
+		div = 2;
+
+	// First conversion after enabling takes 25 ADC clocks, the rest 13
+	g_host_adc_done = g_host_cycles + (uint64_t) div * (g_host_adc_first ? 25 : 13);
+	g_host_adc_first = 0;
+	g_host_adc_busy = 1;
+	HOST_REG(IO_ADCSRA) |= (1 << ADSC);
+}
+
+static void host_adc(void)
+{
+	uint16_t value;
+
+	if(!g_host_adc_busy || g_host_cycles < g_host_adc_done || (HOST_REG(IO_PRR) & (1 << PRADC)))
+		return;
+
+	value = g_host_adc_value[HOST_REG(IO_ADMUX) & 0x0F];
+	if(HOST_REG(IO_ADMUX) & (1 << ADLAR))
+		value <<= 6;
+	HOST_SET16(IO_ADCL, value);
+
+	g_host_adc_busy = 0;
+	HOST_REG(IO_ADCSRA) = (uint8_t) ((HOST_REG(IO_ADCSRA) & ~(1 << ADSC)) | (1 << ADIF));
+
+	// Free running auto trigger starts the next conversion right away
+	if((HOST_REG(IO_ADCSRA) & (1 << ADATE)) && !(HOST_REG(IO_ADCSRB) & 0x07))
+		host_adc_start();
+}
+
+// CPU cycles for one USART0 frame at the current UBRR0/U2X0/frame format
+static uint32_t host_usart_frame(void)
+{
+	uint32_t bits = 10;
+
+	if(HOST_REG(IO_UCSR0C) & (1 << USBS0))
+		bits++;
+	if(HOST_REG(IO_UCSR0C) & (1 << UPM01))
+		bits++;
+
+	return (HOST_REG16(IO_UBRR0) + 1UL) * ((HOST_REG(IO_UCSR0A) & (1 << U2X0)) ? 8 : 16) * bits;
+}
+
+static void host_usart_shift(uint8_t data)
+{
+	if(g_host_tx_count < HOST_USART_BUFFER)
+		g_host_tx[g_host_tx_count++] = data;
+	g_host_tx_busy = 1;
+	g_host_tx_done = g_host_cycles + host_usart_frame();
+}
+
+static void host_usart_write(uint8_t data)
+{
+	if(!(HOST_REG(IO_UCSR0B) & (1 << TXEN0)))
+		return;
+
+	// Straight into the shift register when idle, else into the data buffer
+	if(!g_host_tx_busy)
+		host_usart_shift(data);
+	else
+	{
+		g_host_tx_next = data;
+		g_host_tx_queued = 1;
+		HOST_REG(IO_UCSR0A) &= (uint8_t) ~(1 << UDRE0);
+	}
+}
+
+static void host_usart_read(void)
+{
+	if(g_host_rx_count)
+	{
+		g_host_rx_data = g_host_rx[g_host_rx_head];
+		g_host_rx_head = (uint16_t) ((g_host_rx_head + 1) % HOST_USART_BUFFER);
+		g_host_rx_count--;
+	}
+	else
+		HOST_REG(IO_UCSR0A) &= (uint8_t) ~(1 << RXC0);
+	HOST_REG(IO_UDR0) = g_host_rx_data;
+}
+
+static void host_usart(void)
+{
+	while(g_host_tx_busy && g_host_cycles >= g_host_tx_done)
+	{
+		if(g_host_tx_queued)
+		{
+			g_host_tx_queued = 0;
+			host_usart_shift(g_host_tx_next);
+			HOST_REG(IO_UCSR0A) |= (1 << UDRE0);
+		}
+		else
+		{
+			g_host_tx_busy = 0;
+			HOST_REG(IO_UCSR0A) |= (1 << TXC0);
+		}
+	}
+}
+
+// Edge detection for INT0/INT1, PCINT and ICP1 on a port
+static void host_edges(uint8_t port, uint8_t pin, uint8_t changed)
+{
+	uint8_t n;
+	uint8_t isc;
+
+	if(changed & HOST_REG(IO_PCMSK0 + port))
+		HOST_REG(IO_PCIFR) |= (uint8_t) (1 << port);
+
+	if(port == HOST_PORTD)
+	{
+		for(n = 0; n < 2; n++)
+		{
+			if(!(changed & (1 << (PD2 + n))))
+				continue;
+			isc = (HOST_REG(IO_EICRA) >> (2 * n)) & 0x03;
+			if(isc == 1 || (isc == 2 && !(pin & (1 << (PD2 + n)))) || (isc == 3 && (pin & (1 << (PD2 + n)))))
+				HOST_REG(IO_EIFR) |= (uint8_t) (1 << n);
+		}
+	}
+
+	if(port == HOST_PORTB && (changed & (1 << PB0)))
+	{
+		// ICP1 edge per ICES1, unless ICR1 is in use as TOP
+		n = (HOST_REG(IO_TCCR1A) & 0x03) | ((HOST_REG(IO_TCCR1B) >> 1) & 0x0C);
+		if(n == 8 || n == 10 || n == 12 || n == 14)
+			return;
+		if(((pin & (1 << PB0)) != 0) == ((HOST_REG(IO_TCCR1B) & (1 << ICES1)) != 0))
+		{
+			HOST_SET16(IO_ICR1, HOST_REG16(IO_TCNT1));
+			HOST_REG(IO_TIFR1) |= (1 << ICF1);
+		}
+	}
+}
+
+// PINx follows the output latch for outputs and the external level for inputs
+static void host_ports(void)
+{
+	uint8_t port;
+	uint8_t ddr;
+	uint8_t pin;
+
+	for(port = 0; port < 3; port++)
+	{
+		ddr = HOST_REG(IO_PINB + 3 * port + 1);
+		pin = (uint8_t) (((ddr & HOST_REG(IO_PINB + 3 * port + 2)) | (~ddr & g_host_level[port])) & g_host_pin_mask[port]);
+		HOST_REG(IO_PINB + 3 * port) = pin;
+		if(pin != g_host_pin_last[port])
+		{
+			host_edges(port, pin, pin ^ g_host_pin_last[port]);
+			g_host_pin_last[port] = pin;
+		}
+	}
+}
+
+static void host_step(uint32_t cycles)
+{
+	g_host_cycles += cycles;
+	host_timers(cycles);
+	if(host_clk_io())
+	{
+		host_adc();
+		host_usart();
+	}
+	host_ports();
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Register Access
+ * //////////////////////////////////////////////////////////////////////////
+ */
+
+// Applies the side effects of a byte that was written (or just read). An
+// explicit write (C++ accessor) counts as one even if the value is the same,
+// through a C lvalue only a changed byte can be told from a read.
+static void host_write(uint8_t addr, uint8_t before, uint8_t after, uint8_t written)
+{
+	uint8_t changed = written || before != after;
+	uint8_t value;
+
+	switch(addr)
+	{
+		case IO_PINB: case IO_PINB + 3: case IO_PIND:
+			// (PINx): Writing ones toggles PORTx
+			if(changed)
+				HOST_REG(addr + 2) ^= after;
+			HOST_REG(addr) = before;
+			break;
+
+		case IO_TIFR0: case IO_TIFR1: case IO_TIFR2: case IO_PCIFR: case IO_EIFR:
+			// Flags clear by writing a logic one
+			if(changed)
+				HOST_REG(addr) = (uint8_t) (before & ~after);
+			break;
+
+		case IO_ADCSRA:
+			if(!changed)
+				break;
+			value = (uint8_t) ((after & ~(1 << ADIF)) | (before & (1 << ADSC)));
+			value |= (uint8_t) (before & ~after & (1 << ADIF));
+			if(!(before & (1 << ADEN)) && (after & (1 << ADEN)))
+				g_host_adc_first = 1;
+			if(!(after & (1 << ADEN)))
+			{
+				g_host_adc_busy = 0;
+				value &= (uint8_t) ~(1 << ADSC);
+			}
+			HOST_REG(addr) = value;
+			if(!(before & (1 << ADSC)) && (after & (1 << ADSC)) && (after & (1 << ADEN)))
+				host_adc_start();
+			break;
+
+		case IO_ADCL: case IO_ADCH:
+			HOST_REG(addr) = before;
+			break;
+
+		case IO_UCSR0A:
+			// Only U2X0/MPCM0 are writable, TXC0 clears by writing a one
+			if(changed)
+				HOST_REG(addr) = (uint8_t) ((before & ~((1 << U2X0) | (1 << MPCM0)) & ~(after & (1 << TXC0)))
+					| (after & ((1 << U2X0) | (1 << MPCM0))));
+			break;
+
+		case IO_UDR0:
+			// Unchanged with unread data is taken as a read
+			if(!changed && (HOST_REG(IO_UCSR0A) & (1 << RXC0)))
+				host_usart_read();
+			else
+			{
+				HOST_REG(addr) = g_host_rx_data;
+				host_usart_write(after);
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+static void host_commit(void)
+{
+	uint8_t addr;
+	uint8_t i;
+
+	if(g_host_pending == HOST_NONE)
+		return;
+
+	addr = (uint8_t) g_host_pending;
+	g_host_pending = HOST_NONE;
+	for(i = 0; i < g_host_pending_size; i++)
+		host_write((uint8_t) (addr + i), g_host_shadow[i], HOST_REG((uint8_t) (addr + i)), 0);
+}
+
+static void host_call(uint8_t vector)
+{
+	void (*handler)(void) = gp_host_vectors[vector];
+
+	host_commit();
+	g_host_serviced++;
+	if(!handler)
+	{
+		// avr-gcc would jump to __bad_interrupt and reset
+		g_host_bad++;
+		return;
+	}
+
+	HOST_REG(IO_SREG) &= (uint8_t) ~(1 << SREG_I);
+	host_step(HOST_ISR_CYCLES);
+	handler();
+	host_commit();
+	host_step(HOST_ISR_CYCLES);
+	HOST_REG(IO_SREG) |= (1 << SREG_I);
+}
+
+// Runs the highest priority pending interrupt, if any and if enabled
+static void host_service(void)
+{
+	const host_source_t *p_source;
+	uint8_t n;
+	uint8_t isc;
+
+	if(!(HOST_REG(IO_SREG) & (1 << SREG_I)))
+		return;
+
+	for(n = 0; n < 2; n++)
+	{
+		if(!(HOST_REG(IO_EIMSK) & (1 << n)))
+			continue;
+		isc = (HOST_REG(IO_EICRA) >> (2 * n)) & 0x03;
+		if(HOST_REG(IO_EIFR) & (1 << n))
+			HOST_REG(IO_EIFR) &= (uint8_t) ~(1 << n);
+		else if(isc != 0 || (HOST_REG(IO_PIND) & (1 << (PD2 + n))))
+			continue;
+		host_call((uint8_t) (INT0_vect_num + n));
+		return;
+	}
+
+	for(p_source = g_host_sources; p_source < g_host_sources + sizeof(g_host_sources) / sizeof(g_host_sources[0]); p_source++)
+	{
+		if(!(HOST_REG(p_source->mask_addr) & (1 << p_source->mask_bit)) || !(HOST_REG(p_source->flag_addr) & (1 << p_source->flag_bit)))
+			continue;
+		if(p_source->clear)
+			HOST_REG(p_source->flag_addr) &= (uint8_t) ~(1 << p_source->flag_bit);
+		else if(!gp_host_vectors[p_source->vector])
+			HOST_REG(p_source->mask_addr) &= (uint8_t) ~(1 << p_source->mask_bit);	// Level source, avoid a storm
+		host_call(p_source->vector);
+		return;
+	}
+}
+
+static void host_access(uint8_t addr, uint8_t size)
+{
+	host_commit();
+	host_step(HOST_CYCLES_PER_ACCESS);
+	host_service();
+
+	g_host_pending = addr;
+	g_host_pending_size = size;
+	g_host_shadow[0] = HOST_REG(addr);
+	g_host_shadow[1] = HOST_REG((uint8_t) (addr + 1));
+}
+
+// Clock and interrupts of an explicit access, with no pointer handed out
+static void host_touch(void)
+{
+	host_commit();
+	host_step(HOST_CYCLES_PER_ACCESS);
+	host_service();
+}
+
+static void host_store(uint8_t addr, uint8_t value)
+{
+	uint8_t before = HOST_REG(addr);
+
+	HOST_REG(addr) = value;
+	host_write(addr, before, value, 1);
+}
+
+uint8_t host_read8(uint8_t addr)
+{
+	uint8_t value;
+
+	host_touch();
+	value = HOST_REG(addr);
+
+	// Reading UDR0 takes the received byte out of the buffer
+	if(addr == IO_UDR0 && (HOST_REG(IO_UCSR0A) & (1 << RXC0)))
+		host_usart_read();
+	return value;
+}
+
+uint16_t host_read16(uint8_t addr)
+{
+	host_touch();
+	return HOST_REG16(addr);
+}
+
+void host_write8(uint8_t addr, uint8_t value)
+{
+	host_touch();
+	host_store(addr, value);
+}
+
+void host_write16(uint8_t addr, uint16_t value)
+{
+	// High byte first, as the TEMP register requires on the AVR
+	host_touch();
+	host_store((uint8_t) (addr + 1), (uint8_t) (value >> 8));
+	host_store(addr, (uint8_t) value);
+}
+
+volatile uint8_t *host_io8(uint8_t addr)
+{
+	host_access(addr, 1);
+	return (volatile uint8_t *) &g_host_mem[addr];
+}
+
+volatile uint16_t *host_io16(uint8_t addr)
+{
+	host_access(addr, 2);
+	return (volatile uint16_t *) (void *) &g_host_mem[addr];
+}
+
+void host_register_isr(uint8_t vector, void (*handler)(void))
+{
+	if(vector < _VECTORS_SIZE)
+		gp_host_vectors[vector] = handler;
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Time and Sleep
+ * //////////////////////////////////////////////////////////////////////////
+ */
+void host_delay_cycles(uint32_t cycles)
+{
+	uint32_t step;
+
+	host_commit();
+	while(cycles)
+	{
+		step = (cycles < HOST_STEP) ? cycles : HOST_STEP;
+		host_step(step);
+		host_service();
+		cycles -= step;
+	}
+}
+
+void host_run(uint32_t cycles)
+{
+	host_delay_cycles(cycles);
+}
+
+// Advances until an interrupt is serviced, or HOST_SLEEP_LIMIT cycles pass
+void host_sleep(void)
+{
+	uint32_t serviced;
+	uint32_t waited;
+
+	host_commit();
+	if(!(HOST_REG(IO_SMCR) & (1 << SE)))
+		return;
+
+	g_host_sleep_mode = HOST_SLEEP_MODE(HOST_REG(IO_SMCR));
+	g_host_sleeping = 1;
+
+	// ADC noise reduction starts a conversion on entry
+	if(g_host_sleep_mode == HOST_MODE_ADC && (HOST_REG(IO_ADCSRA) & (1 << ADEN)) && !g_host_adc_busy)
+		host_adc_start();
+
+	serviced = g_host_serviced;
+	for(waited = 0; g_host_serviced == serviced && waited < HOST_SLEEP_LIMIT; waited += HOST_STEP)
+	{
+		host_step(HOST_STEP);
+		if(g_host_serviced == serviced)
+		{
+			// Wake up first so the handler runs with every clock back on
+			if(HOST_REG(IO_SREG) & (1 << SREG_I))
+			{
+				g_host_sleeping = 0;
+				host_service();
+				if(g_host_serviced == serviced)
+					g_host_sleeping = 1;
+			}
+		}
+	}
+	g_host_sleeping = 0;
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Host Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+void host_reset(void)
+{
+	g_host_pending = HOST_NONE;
+	memset(g_host_mem, 0, sizeof(g_host_mem));
+	memset(g_host_timer, 0, sizeof(g_host_timer));
+	memset(g_host_adc_value, 0, sizeof(g_host_adc_value));
+
+	g_host_cycles = 0;
+	g_host_serviced = 0;
+	g_host_bad = 0;
+	g_host_sleeping = 0;
+
+	g_host_adc_busy = 0;
+	g_host_adc_first = 0;
+	g_host_adc_value[14] = 225;		// 1.1 V bandgap against 5 V AVcc
+
+	g_host_rx_head = 0;
+	g_host_rx_count = 0;
+	g_host_rx_data = 0;
+	g_host_tx_count = 0;
+	g_host_tx_busy = 0;
+	g_host_tx_queued = 0;
+	HOST_REG(IO_UCSR0A) = (1 << UDRE0);
+
+	// Inputs float high, as with the pull-ups on
+	memset(g_host_level, 0xFF, sizeof(g_host_level));
+	memset(g_host_pin_last, 0, sizeof(g_host_pin_last));
+	host_ports();
+	HOST_REG(IO_PCIFR) = 0;
+	HOST_REG(IO_EIFR) = 0;
+	HOST_REG(IO_TIFR1) = 0;
+}
+
+__attribute__((constructor)) static void host_init(void)
+{
+	host_reset();
+}
+
+uint64_t host_cycles(void)
+{
+	return g_host_cycles;
+}
+
+// Runs a vector's handler now, as on interrupt entry
+void host_raise(uint8_t vector)
+{
+	if(vector < _VECTORS_SIZE)
+		host_call(vector);
+}
+
+uint16_t host_bad_interrupts(void)
+{
+	return g_host_bad;
+}
+
+void host_set_pin(uint8_t port, uint8_t pin, uint8_t level)
+{
+	if(port > HOST_PORTD || pin > 7)
+		return;
+
+	host_commit();
+	if(level)
+		g_host_level[port] |= (uint8_t) (1 << pin);
+	else
+		g_host_level[port] &= (uint8_t) ~(1 << pin);
+	host_ports();
+	host_service();
+}
+
+uint8_t host_get_pin(uint8_t port, uint8_t pin)
+{
+	if(port > HOST_PORTD || pin > 7)
+		return 0;
+
+	host_commit();
+	host_ports();
+	return (HOST_REG(IO_PINB + 3 * port) >> pin) & 1;
+}
+
+void host_set_adc(uint8_t channel, uint16_t value)
+{
+	g_host_adc_value[channel & 0x0F] = value & 0x03FF;
+}
+
+// Queues a received byte, returns 0 when the receiver is off or full
+uint8_t host_usart_receive(uint8_t data)
+{
+	host_commit();
+	if(!(HOST_REG(IO_UCSR0B) & (1 << RXEN0)))
+		return 0;
+
+	if(!(HOST_REG(IO_UCSR0A) & (1 << RXC0)))
+	{
+		g_host_rx_data = data;
+		HOST_REG(IO_UDR0) = data;
+		HOST_REG(IO_UCSR0A) |= (1 << RXC0);
+	}
+	else if(g_host_rx_count < HOST_USART_BUFFER)
+		g_host_rx[(g_host_rx_head + g_host_rx_count++) % HOST_USART_BUFFER] = data;
+	else
+		return 0;
+
+	host_service();
+	return 1;
+}
+
+// Moves up to size captured transmit bytes into buffer, returns the count
+uint16_t host_usart_transmitted(uint8_t *buffer, uint16_t size)
+{
+	uint16_t n;
+
+	host_commit();
+	n = (size < g_host_tx_count) ? size : g_host_tx_count;
+	memcpy(buffer, g_host_tx, n);
+	memmove(g_host_tx, g_host_tx + n, g_host_tx_count - n);
+	g_host_tx_count = (uint16_t) (g_host_tx_count - n);
+	return n;
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							avr-libc Extensions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+char *ultoa(unsigned long value, char *str, int radix)
+{
+	char digits[8 * sizeof(unsigned long)];
+	uint8_t n = 0;
+	char *p = str;
+	unsigned long d;
+
+	if(radix < 2 || radix > 36)
+	{
+		*str = '\0';
+		return str;
+	}
+
+	do
+	{
+		d = value % (unsigned long) radix;
+		digits[n++] = (char) ((d < 10) ? '0' + d : 'a' + d - 10);
+		value /= (unsigned long) radix;
+	} while(value);
+
+	while(n)
+		*p++ = digits[--n];
+	*p = '\0';
+	return str;
+}
+
+char *ltoa(long value, char *str, int radix)
+{
+	if(value < 0 && radix == 10)
+	{
+		*str = '-';
+		ultoa(0UL - (unsigned long) value, str + 1, radix);
+		return str;
+	}
+	return ultoa((unsigned long) value, str, radix);
+}
+
+char *utoa(unsigned int value, char *str, int radix)
+{
+	return ultoa(value, str, radix);
+}
+
+char *itoa(int value, char *str, int radix)
+{
+	if(radix == 10)
+		return ltoa(value, str, radix);
+	return utoa((unsigned int) value, str, radix);
+}
@@ -0,0 +1,93 @@
+/*
+ * host_sim.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _HOST_SIM_H_
+#define _HOST_SIM_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Host Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Register-mock ATmega328P for building and testing the libraries on a
+ * Linux host. The stand-in headers in Host/avr and Host/util replace the
+ * avr-libc ones (add -IHost ahead of everything else), and every register
+ * access goes through host_io8()/host_io16() in host_sim.c, which advances
+ * the simulated clock and runs the peripheral models:
+ *	Timers 0/1/2: Count per prescaler in every WGM mode, set OCF/TOV/ICF
+ *	ADC: ADSC starts a 13 ADC clock conversion of the host_set_adc() value
+ *	USART0: UDR0 writes are captured with real frame timing, RX is injected
+ *	Ports: PINx follows DDRx/PORTx and host_set_pin(), PINx writes toggle
+ *	INT0/INT1/PCINT: Pin edges set EIFR/PCIFR as configured
+ *	Interrupts: Pending vectors run in priority order while SREG_I is set
+ *
+ * Built as C++ (as the Makefile does), each register is an accessor
+ * object from avr/io.h and every store is recorded as a write, so the W1C
+ * flags (TIFRn, EIFR, PCIFR, ADIF, TXC0), PINx toggles and UDR0 behave as
+ * on the chip even when the value does not change. Plain C gets a pointer
+ * and a write is only seen at the next register access, by comparing the
+ * byte against its value when the pointer was handed out, so there a
+ * write of the same value reads as a read.
+ *
+ * Cycle counts are an approximation (HOST_CYCLES_PER_ACCESS per register
+ * access, nothing for plain code), good for ordering and timeouts but not
+ * for benchmarks.
+ */
+
+// Simulated CPU cycles charged per register access
+#ifndef HOST_CYCLES_PER_ACCESS
+#define HOST_CYCLES_PER_ACCESS 2
+#endif
+
+// Longest sleep_cpu() without any wake-up source before giving up
+#ifndef HOST_SLEEP_LIMIT
+#define HOST_SLEEP_LIMIT (F_CPU)
+#endif
+
+// USART0 receive and transmit capture buffers (bytes)
+#ifndef HOST_USART_BUFFER
+#define HOST_USART_BUFFER 256
+#endif
+
+// Port Index
+#define HOST_PORTB 0
+#define HOST_PORTC 1
+#define HOST_PORTD 2
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Host Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+void host_reset(void);
+uint64_t host_cycles(void);
+void host_run(uint32_t cycles);
+void host_raise(uint8_t vector);
+uint16_t host_bad_interrupts(void);
+
+void host_set_pin(uint8_t port, uint8_t pin, uint8_t level);
+uint8_t host_get_pin(uint8_t port, uint8_t pin);
+void host_set_adc(uint8_t channel, uint16_t value);
+
+uint8_t host_usart_receive(uint8_t data);
+uint16_t host_usart_transmitted(uint8_t *buffer, uint16_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HOST_SIM_H_ */
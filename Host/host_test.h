@@ -0,0 +1,41 @@
+/*
+ * host_test.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <stdio.h>
+#include "host_sim.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Host Test Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Minimal checks for the Host/test_*.c programs run by "make test". A
+ * failed HOST_CHECK() prints the location and keeps going, HOST_RESULT()
+ * is main()'s exit code:
+ *	HOST_CHECK(read_adc(ADC_CHANNEL_3) == 512);
+ *	return HOST_RESULT();
+ */
+static unsigned int g_host_checks;
+static unsigned int g_host_failures;
+
+#define HOST_CHECK(cond) do { \
+	g_host_checks++; \
+	if(!(cond)) \
+	{ \
+		g_host_failures++; \
+		printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+	} \
+} while(0)
+
+#define HOST_RESULT() \
+	(printf("%s: %u of %u checks passed\n", __FILE__, g_host_checks - g_host_failures, g_host_checks), \
+	g_host_failures != 0)
+
+#endif /* _HOST_TEST_H_ */
@@ -0,0 +1,50 @@
+/*
+ * templates.cpp
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ *
+ * Instantiates the header-only C++ front ends for "make cxx", so their
+ * member functions are compiled and not only parsed. Never linked.
+ */
+#include "USART.hpp"
+#include "ADC.hpp"
+#include "TIMER.hpp"
+#include "Pin.hpp"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Template Instances
+ * //////////////////////////////////////////////////////////////////////////
+ */
+template class Usart<9600>;
+template class Usart<115200>;
+template class Adc<ADC_REFERENCE_ACC, ADC_PRESCALER_128>;
+template class Timer1<TIMER1_MODE_CTC, 1000>;
+template class Timer1<TIMER1_MODE_CTC_ICR1, 1000>;
+template class Timer1<TIMER1_MODE_FAST_PWM, 20000>;
+template class Timer1<TIMER1_MODE_PHASE_PWM, 20000>;
+template class Pin<PIN_PORT_B, 5>;
+template class Pin<PIN_PORT_C, 0>;
+template class Pin<PIN_PORT_D, 7>;
+
+typedef Adc<ADC_REFERENCE_ACC, ADC_PRESCALER_128> Analog;
+typedef Timer1<TIMER1_MODE_FAST_PWM, 20000> ServoClock;
+typedef Timer1<TIMER1_MODE_CTC, 1000> Tick;
+
+// Member templates are only instantiated where they are called
+void templates_members()
+{
+	volatile uint16_t sink;
+
+	sink = Analog::read<ADC_CHANNEL_3>();
+	sink = Analog::read<ADC_CHANNEL_BANDGAP>();
+	sink = Analog::read8<ADC_CHANNEL_0>();
+
+	ServoClock::pwm<PWM_CHANNEL_A>();
+	ServoClock::pwm<PWM_CHANNEL_B>();
+	ServoClock::duty<PWM_CHANNEL_A>(ServoClock::ticks_us(1500));
+	ServoClock::duty<PWM_CHANNEL_B>(ServoClock::ticks_us(1000));
+	Tick::duty<PWM_CHANNEL_B>(Tick::top / 2);
+	(void) sink;
+}
@@ -0,0 +1,45 @@
+/*
+ * test_adc.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "host_test.h"
+#include "ADC.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							ADC Tests
+ * //////////////////////////////////////////////////////////////////////////
+ */
+
+/* Single conversion waits on ADSC, 13 ADC clocks (25 for the first one) */
+static void test_adc_single()
+{
+	uint64_t start;
+	uint16_t value;
+
+	host_reset();
+	init_adc(ADC_PRESCALER_128, ADC_ADJUST_RIGHT, ADC_REFERENCE_ACC, ADC_SINGLE_MODE);
+	host_set_adc(ADC_CHANNEL_3, 512);
+	host_set_adc(ADC_CHANNEL_5, 1023);
+
+	start = host_cycles();
+	value = read_adc(ADC_CHANNEL_3);
+	HOST_CHECK(value == 512);
+	HOST_CHECK(host_cycles() - start >= 25 * 128);
+	HOST_CHECK(!(ADCSRA & (1 << ADSC)));
+
+	start = host_cycles();
+	value = read_adc(ADC_CHANNEL_5);
+	HOST_CHECK(value == 1023);
+	HOST_CHECK(host_cycles() - start >= 13 * 128);
+	HOST_CHECK(host_cycles() - start < 25 * 128);
+}
+
+int main(void)
+{
+	test_adc_single();
+	return HOST_RESULT();
+}
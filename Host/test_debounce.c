@@ -0,0 +1,63 @@
+/*
+ * test_debounce.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "host_test.h"
+#include "Debounce.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Debounce Tests
+ * //////////////////////////////////////////////////////////////////////////
+ */
+
+/* Four equal samples toggle a pin, a bounce starts the count over */
+static void test_debounce_press()
+{
+	host_reset();
+	host_set_pin(HOST_PORTC, 2, 1);
+	host_set_pin(HOST_PORTC, 4, 1);
+	init_debounce(DEBOUNCE_PORT_C, (1 << 2) | (1 << 4));
+	HOST_CHECK(debounce_state(DEBOUNCE_PORT_C) == 0);
+
+	// Pressed pulls the pin low
+	host_set_pin(HOST_PORTC, 2, 0);
+	for(uint8_t i = 0; i < 3; i++)
+		debounce_tick(0);
+	HOST_CHECK(debounce_state(DEBOUNCE_PORT_C) == 0);
+	debounce_tick(0);
+	HOST_CHECK(debounce_state(DEBOUNCE_PORT_C) == (1 << 2));
+	HOST_CHECK(debounce_pressed(DEBOUNCE_PORT_C) == (1 << 2));
+	HOST_CHECK(debounce_pressed(DEBOUNCE_PORT_C) == 0);
+
+	// Release bouncing after three samples
+	host_set_pin(HOST_PORTC, 2, 1);
+	for(uint8_t i = 0; i < 3; i++)
+		debounce_tick(0);
+	host_set_pin(HOST_PORTC, 2, 0);
+	debounce_tick(0);
+	host_set_pin(HOST_PORTC, 2, 1);
+	for(uint8_t i = 0; i < 3; i++)
+		debounce_tick(0);
+	HOST_CHECK(debounce_state(DEBOUNCE_PORT_C) == (1 << 2));
+	HOST_CHECK(debounce_released(DEBOUNCE_PORT_C) == 0);
+	debounce_tick(0);
+	HOST_CHECK(debounce_state(DEBOUNCE_PORT_C) == 0);
+	HOST_CHECK(debounce_released(DEBOUNCE_PORT_C) == (1 << 2));
+	HOST_CHECK(debounce_released(DEBOUNCE_PORT_C) == 0);
+
+	// Pins outside the mask are not debounced
+	host_set_pin(HOST_PORTC, 3, 0);
+	for(uint8_t i = 0; i < 4; i++)
+		debounce_tick(0);
+	HOST_CHECK(debounce_state(DEBOUNCE_PORT_C) == 0);
+}
+
+int main(void)
+{
+	test_debounce_press();
+	return HOST_RESULT();
+}
@@ -0,0 +1,99 @@
+/*
+ * test_interrupt.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "host_test.h"
+#include "Interrupt.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Interrupt Tests
+ * //////////////////////////////////////////////////////////////////////////
+ */
+typedef struct
+{
+	uint8_t calls;
+	uint8_t edge;
+} test_pin_t;
+
+static void record(uint8_t edge, void *ctx)
+{
+	test_pin_t *pin = (test_pin_t *) ctx;
+	pin->calls++;
+	pin->edge = edge;
+}
+
+/* INT0 (PD2) on the falling edge, INT0_DISPATCH=1 runs the callback in the ISR */
+static void test_int0()
+{
+	test_pin_t pin = { 0, 0xFF };
+
+	host_reset();
+	host_set_pin(HOST_PORTD, PD2, 1);
+	HOST_CHECK(interrupt_attach(EXTERNAL_INTERRUPT_REQUEST_0, INTERRUPT_MODE_FALLING_EDGE, record, &pin));
+	HOST_CHECK(pin.calls == 0);
+
+	host_set_pin(HOST_PORTD, PD2, 0);
+	HOST_CHECK(pin.calls == 1 && pin.edge == 0);
+	host_set_pin(HOST_PORTD, PD2, 1);
+	HOST_CHECK(pin.calls == 1);
+	host_set_pin(HOST_PORTD, PD2, 0);
+	HOST_CHECK(pin.calls == 2);
+
+	// Any change, the callback gets the level after it
+	HOST_CHECK(interrupt_attach(EXTERNAL_INTERRUPT_REQUEST_0, INTERRUPT_MODE_LOGICAL_CHANGE, record, &pin));
+	host_set_pin(HOST_PORTD, PD2, 1);
+	HOST_CHECK(pin.calls == 3 && pin.edge == 1);
+
+	interrupt_detach(EXTERNAL_INTERRUPT_REQUEST_0);
+	host_set_pin(HOST_PORTD, PD2, 0);
+	HOST_CHECK(pin.calls == 3);
+
+	// INT1_DISPATCH is compiled out
+	HOST_CHECK(!interrupt_attach(EXTERNAL_INTERRUPT_REQUEST_1, INTERRUPT_MODE_FALLING_EDGE, record, &pin));
+	HOST_CHECK(host_bad_interrupts() == 0);
+}
+
+/* Pin changes on Port B, each attached pin gets its own callback context */
+static void test_pcint()
+{
+	test_pin_t pb1 = { 0, 0xFF };
+	test_pin_t pb5 = { 0, 0xFF };
+
+	host_reset();
+	HOST_CHECK(pcint_attach(PIN_CHANGE_INTERRUPT_0, 1, record, &pb1));
+	HOST_CHECK(pcint_attach(PIN_CHANGE_INTERRUPT_0, 5, record, &pb5));
+
+	// Inputs idle high
+	host_set_pin(HOST_PORTB, 1, 0);
+	HOST_CHECK(pb1.calls == 1 && pb1.edge == PCINT_EDGE_FALLING);
+	HOST_CHECK(pb5.calls == 0);
+
+	host_set_pin(HOST_PORTB, 5, 0);
+	host_set_pin(HOST_PORTB, 5, 1);
+	HOST_CHECK(pb5.calls == 2 && pb5.edge == PCINT_EDGE_RISING);
+	HOST_CHECK(pb1.calls == 1);
+
+	// Unmasked pins of the port raise nothing
+	host_set_pin(HOST_PORTB, 3, 0);
+	HOST_CHECK(pb1.calls == 1 && pb5.calls == 2);
+
+	pcint_detach(PIN_CHANGE_INTERRUPT_0, 1);
+	host_set_pin(HOST_PORTB, 1, 1);
+	HOST_CHECK(pb1.calls == 1);
+
+	// The last pin takes the port down
+	pcint_detach(PIN_CHANGE_INTERRUPT_0, 5);
+	HOST_CHECK(!(PCICR & (1 << PCIE0)));
+	HOST_CHECK(host_bad_interrupts() == 0);
+}
+
+int main(void)
+{
+	test_int0();
+	test_pcint();
+	return HOST_RESULT();
+}
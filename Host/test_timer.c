@@ -0,0 +1,107 @@
+/*
+ * test_timer.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include "host_test.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Timer Tests
+ * //////////////////////////////////////////////////////////////////////////
+ */
+static volatile uint16_t g_ticks;
+
+static void tick()
+{
+	g_ticks++;
+}
+
+/* Polled overflow flag of Timer 1, cleared by writing a logic one to TOV1 */
+static void test_timer1_overflow()
+{
+	host_reset();
+	init_timer1(WAVEFORM_NORMAL, 0, COMPARE_NORMAL, TIMER1_PRESCALER_1, 0, 0);
+	HOST_CHECK(!check_timer1_overflow());
+
+	// 65536 clk/1 ticks to the first overflow
+	host_run(60000);
+	HOST_CHECK(!check_timer1_overflow());
+	host_run(6000);
+	HOST_CHECK(check_timer1_overflow());
+
+	reset_timer1();
+	HOST_CHECK(!check_timer1_overflow());
+
+	stop_timer1();
+	host_run(70000);
+	HOST_CHECK(!check_timer1_overflow());
+}
+
+/* 1 ms CTC on Timer 2, TIMER2_COMPA_DISPATCH=1 runs the callback in the ISR */
+static void test_timer2_interrupt()
+{
+	host_reset();
+	g_ticks = 0;
+	HOST_CHECK(init_timer2(WAVEFORM_CTC_OCR2A, 1, COMPARE_NORMAL, TIMER2_PRESCALER_128, 1, tick));
+
+	host_run(F_CPU / 100);
+	HOST_CHECK(g_ticks >= 9 && g_ticks <= 11);
+
+	// Injected vector, as if the compare match had just happened
+	uint16_t ticks = g_ticks;
+	host_raise(TIMER2_COMPA_vect_num);
+	HOST_CHECK(g_ticks == ticks + 1);
+
+	// Masked while interrupts are off
+	cli();
+	ticks = g_ticks;
+	host_run(F_CPU / 100);
+	HOST_CHECK(g_ticks == ticks);
+
+	timer_detach(TIMER2_COMPA);
+	stop_timer2();
+	HOST_CHECK(host_bad_interrupts() == 0);
+}
+
+/* CTC periods in 32-bit arithmetic as on the AVR, too long saturates at 0xFFFF */
+static void test_timer1_period()
+{
+	host_reset();
+	init_timer1(WAVEFORM_CTC_OCR1A, 4, COMPARE_NORMAL, TIMER1_PRESCALER_1, 0, 0);
+	HOST_CHECK(OCR1A == 63999);
+
+	// 16e6 * 537 wraps 32 bits when multiplied first
+	stop_timer1();
+	init_timer1(WAVEFORM_CTC_OCR1A, 537, COMPARE_NORMAL, TIMER1_PRESCALER_1, 0, 0);
+	HOST_CHECK(OCR1A == 0xFFFF);
+
+	stop_timer1();
+	init_timer1(WAVEFORM_CTC_OCR1A, 4000, COMPARE_NORMAL, TIMER1_PRESCALER_1024, 0, 0);
+	HOST_CHECK(OCR1A == 62499);
+
+	stop_timer1();
+	init_timer1(WAVEFORM_CTC_OCR1A, 60000, COMPARE_NORMAL, TIMER1_PRESCALER_8, 0, 0);
+	HOST_CHECK(OCR1A == 0xFFFF);
+	stop_timer1();
+}
+
+/* A callback for a vector compiled out (TIMER1_COMPA_DISPATCH=0) is refused */
+static void test_timer1_no_dispatch()
+{
+	host_reset();
+	HOST_CHECK(!init_timer1(WAVEFORM_CTC_OCR1A, 1, COMPARE_NORMAL, TIMER1_PRESCALER_64, 1, tick));
+	HOST_CHECK(!(TCCR1B & ((1 << CS12) | (1 << CS11) | (1 << CS10))));
+}
+
+int main(void)
+{
+	test_timer1_overflow();
+	test_timer1_period();
+	test_timer2_interrupt();
+	test_timer1_no_dispatch();
+	return HOST_RESULT();
+}
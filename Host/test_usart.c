@@ -0,0 +1,81 @@
+/*
+ * test_usart.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+
+#include <string.h>
+#include "host_test.h"
+#include "USART.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							USART Tests
+ * //////////////////////////////////////////////////////////////////////////
+ */
+// One frame at 9600 baud: (UBRR0 + 1) * 16 * 10 bits
+#define TEST_FRAME_CYCLES ((F_CPU / (16UL * 9600UL)) * 16UL * 10UL)
+
+/* tx_byte() waits for UDRE0 only once the shift register and UDR0 are both full */
+static void test_usart_tx()
+{
+	uint8_t buffer[8];
+	uint64_t start;
+
+	host_reset();
+	init_usart(F_CPU, USART_BAUD_RATE_9600, 0);
+
+	// Straight into the shift register, then into UDR0
+	start = host_cycles();
+	tx_byte('A');
+	tx_byte('B');
+	HOST_CHECK(host_cycles() - start < TEST_FRAME_CYCLES / 2);
+	HOST_CHECK(!(UCSR0A & (1 << UDRE0)));
+
+	// Waits until 'A' is out and 'B' moves to the shift register
+	tx_byte('C');
+	HOST_CHECK(host_cycles() - start >= TEST_FRAME_CYCLES);
+
+	host_run(3 * TEST_FRAME_CYCLES);
+	HOST_CHECK(host_usart_transmitted(buffer, sizeof(buffer)) == 3);
+	HOST_CHECK(memcmp(buffer, "ABC", 3) == 0);
+	HOST_CHECK(UCSR0A & (1 << TXC0));
+
+	put_string("ok");
+	print_byte(42);
+	host_run(6 * TEST_FRAME_CYCLES);
+	HOST_CHECK(host_usart_transmitted(buffer, sizeof(buffer)) == 5);
+	HOST_CHECK(memcmp(buffer, "ok042", 5) == 0);
+}
+
+/* rx_byte() returns the injected bytes in order, get_string() stops at Enter */
+static void test_usart_rx()
+{
+	char str[8];
+
+	host_reset();
+	init_usart(F_CPU, USART_BAUD_RATE_9600, 0);
+	HOST_CHECK(!(UCSR0A & (1 << RXC0)));
+
+	HOST_CHECK(host_usart_receive('x'));
+	HOST_CHECK(host_usart_receive('y'));
+	HOST_CHECK(UCSR0A & (1 << RXC0));
+	HOST_CHECK(rx_byte() == 'x');
+	HOST_CHECK(rx_byte() == 'y');
+	HOST_CHECK(!(UCSR0A & (1 << RXC0)));
+
+	host_usart_receive('h');
+	host_usart_receive('i');
+	host_usart_receive(13);
+	get_string(str, sizeof(str) - 1);
+	HOST_CHECK(strcmp(str, "hi") == 0);
+	HOST_CHECK(!(UCSR0A & (1 << RXC0)));
+}
+
+int main(void)
+{
+	test_usart_tx();
+	test_usart_rx();
+	return HOST_RESULT();
+}
@@ -0,0 +1,38 @@
+/*
+ * atomic.h (host)
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ *
+ * Host stand-in for <util/atomic.h>, built on the simulated SREG.
+ */
+#pragma once
+#ifndef _HOST_UTIL_ATOMIC_H_
+#define _HOST_UTIL_ATOMIC_H_
+
+#include <avr/interrupt.h>
+
+static inline uint8_t __host_atomic_cli(void)
+{
+	cli();
+	return 1;
+}
+
+static inline void __host_atomic_restore(const uint8_t *sreg)
+{
+	SREG = *sreg;
+}
+
+static inline void __host_atomic_force_on(const uint8_t *sreg)
+{
+	(void) sreg;
+	sei();
+}
+
+#define ATOMIC_RESTORESTATE uint8_t __sreg_save __attribute__((__cleanup__(__host_atomic_restore))) = SREG
+#define ATOMIC_FORCEON uint8_t __sreg_save __attribute__((__cleanup__(__host_atomic_force_on))) = 0
+
+#define ATOMIC_BLOCK(type) \
+	for(type, __todo = __host_atomic_cli(); __todo; __todo = 0)
+
+#endif /* _HOST_UTIL_ATOMIC_H_ */
@@ -0,0 +1,33 @@
+/*
+ * delay.h (host)
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ *
+ * Host stand-in for <util/delay.h>: busy-waits advance the simulated
+ * clock by the equivalent number of CPU cycles instead of spinning.
+ */
+#pragma once
+#ifndef _HOST_UTIL_DELAY_H_
+#define _HOST_UTIL_DELAY_H_
+
+#include <avr/io.h>
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void host_delay_cycles(uint32_t cycles);
+
+#define _delay_us(us) host_delay_cycles((uint32_t) ((double) (F_CPU) * (us) / 1e6))
+#define _delay_ms(ms) host_delay_cycles((uint32_t) ((double) (F_CPU) * (ms) / 1e3))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HOST_UTIL_DELAY_H_ */
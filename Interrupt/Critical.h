@@ -0,0 +1,114 @@
+/*
+ * critical.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _CRITICAL_H_
+#define _CRITICAL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Critical Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Set CRITICAL_INSTRUMENT to 1 project-wide to record the longest
+// interrupts-disabled window (needs init_millis()) and the worst entry
+// latency of each instrumented vector. Left at 0 it costs nothing.
+#ifndef CRITICAL_INSTRUMENT
+#define CRITICAL_INSTRUMENT 0
+#endif
+
+// ATmega328P interrupt vectors, indexed by their vector_num
+#define CRITICAL_VECTOR_COUNT 26
+
+// SREG as it was before the section
+typedef uint8_t critical_t;
+
+// Open sections, interrupts are never re-enabled while one is open
+extern volatile uint8_t g_critical_depth;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Critical Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#if CRITICAL_INSTRUMENT
+void critical_window_begin();
+void critical_window_end();
+void critical_isr_latency(uint8_t vector, uint16_t cycles);
+uint16_t critical_longest_window_us();
+uint16_t critical_max_latency(uint8_t vector);
+void critical_instrument_reset();
+#endif
+
+/* Disable Interrupts and return the Previous State, sections nest */
+static inline critical_t critical_enter()
+{
+	critical_t sreg = SREG;
+	cli();
+
+#if CRITICAL_INSTRUMENT
+	if(sreg & (1 << SREG_I))
+		critical_window_begin();
+#endif
+
+	g_critical_depth++;
+	return sreg;
+}
+
+/* Restore the State saved by critical_enter() */
+static inline void critical_exit(critical_t sreg)
+{
+	g_critical_depth--;
+
+#if CRITICAL_INSTRUMENT
+	if(sreg & (1 << SREG_I))
+		critical_window_end();
+#endif
+
+	SREG = sreg;
+}
+
+static inline void critical_cleanup(critical_t *sreg)
+{
+	critical_exit(*sreg);
+}
+
+/* 
+ * Run a Block with Interrupts Disabled: SREG is saved and cli() called on
+ * entry, and SREG is restored on any exit, break and return included.
+ * Blocks nest, g_critical_depth counts the open ones
+ */
+#define CRITICAL_BLOCK() \
+	for(critical_t _critical_sreg __attribute__((__cleanup__(critical_cleanup))) = critical_enter(), _critical_once = 1; \
+		_critical_once; _critical_once = 0)
+
+/* 
+ * Set the Global Interrupt Enable Bit, unless a critical section is open
+ * Library init functions use it instead of sei(), so calling them from a
+ * CRITICAL_BLOCK() does not end the caller's section early
+ */
+static inline void critical_sei()
+{
+	if(!g_critical_depth)
+		sei();
+}
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _CRITICAL_H_ */
@@ -0,0 +1,87 @@
+/*
+ * edgelog.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _EDGELOG_H_
+#define _EDGELOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include "Critical.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Edge Log Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Edges of INT0/INT1 enabled with INTERRUPT_MODE_LOG are stamped by the
+// interrupt dispatcher. Build with INTERRUPT_EDGE_LOG=1 and INTn_DISPATCH set.
+// The stamps are microseconds from the clock picked by EDGELOG_CLOCK:
+//	EDGELOG_CLOCK_MILLIS: micros(), 4 us steps, init_millis() must be running
+//	EDGELOG_CLOCK_TIMER1: Timer 1 free running at clk/8, 1 us steps. Started
+//	by init_edgelog(), edgelog.c then owns Timer 1 and TIMER1_OVF_vect
+#define EDGELOG_CLOCK_MILLIS 0
+#define EDGELOG_CLOCK_TIMER1 1
+
+#ifndef EDGELOG_CLOCK
+#define EDGELOG_CLOCK EDGELOG_CLOCK_MILLIS
+#endif
+
+#if EDGELOG_CLOCK == EDGELOG_CLOCK_TIMER1
+// Timer 1 ticks per microsecond at clk/8, a power of two
+#define EDGELOG_TICKS_PER_US ((F_CPU) / 8000000UL)
+
+#if (F_CPU) % 8000000UL != 0 || (EDGELOG_TICKS_PER_US != 1 && EDGELOG_TICKS_PER_US != 2)
+#error "Edge Log: EDGELOG_CLOCK_TIMER1 needs F_CPU at 8 or 16 MHz"
+#endif
+
+#define EDGELOG_TICK_SHIFT (EDGELOG_TICKS_PER_US == 2)
+#endif
+
+#ifndef EDGELOG_SIZE
+#define EDGELOG_SIZE 32
+#endif
+
+#if (EDGELOG_SIZE & (EDGELOG_SIZE - 1)) != 0 || EDGELOG_SIZE > 128
+#error "Edge Log: EDGELOG_SIZE must be a power of two up to 128"
+#endif
+
+// Source byte of an entry
+#define EDGELOG_INTERRUPT_MASK 0x01 // '0': INT0, '1': INT1
+#define EDGELOG_RISING 0x80			// Pin high after the edge
+
+typedef struct
+{
+	uint32_t us;	// Microseconds at the interrupt, from EDGELOG_CLOCK
+	uint8_t source; // Interrupt and level
+} edgelog_entry_t;
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Edge Log Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_edgelog();
+void edgelog_enable(uint8_t interrupt);
+void edgelog_disable(uint8_t interrupt);
+void edgelog_record(uint8_t interrupt, uint8_t level);
+uint8_t edgelog_read(edgelog_entry_t *entry);
+uint8_t edgelog_count();
+uint16_t edgelog_dropped();
+void edgelog_print();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _EDGELOG_H_ */
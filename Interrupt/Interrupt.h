@@ -18,6 +18,9 @@ extern "C" {
 
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include "Critical.h"
+#include "Event.h"
+#include "EdgeLog.h"
 
 /*
  * //////////////////////////////////////////////////////////////////////////
@@ -39,6 +42,60 @@ extern "C" {
 #define INTERRUPT_MODE_FALLING_EDGE 2
 #define INTERRUPT_MODE_RISING_EDGE 3
 
+// OR with a mode to timestamp every INT0/INT1 edge into the edge log
+// (EdgeLog.h), needs INTERRUPT_EDGE_LOG=1 and INTn_DISPATCH set
+#define INTERRUPT_MODE_LOG 0x04
+
+#ifndef INTERRUPT_EDGE_LOG
+#define INTERRUPT_EDGE_LOG 0
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Interrupt Dispatch Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+/* 
+ * Vector Dispatch, set project-wide for each vector (e.g. -DPCINT2_DISPATCH=1)
+ * '0': Compiled out, the vector is left free for other modules (default)
+ * '1': Direct, the callbacks run inside the ISR
+ * '2': Deferred, the ISR only queues events and the callbacks run from
+ *      event_dispatch() in the main loop (needs Event.c)
+ */
+#define INTERRUPT_DISPATCH_NONE 0
+#define INTERRUPT_DISPATCH_DIRECT 1
+#define INTERRUPT_DISPATCH_DEFERRED 2
+
+#ifndef INT0_DISPATCH
+#define INT0_DISPATCH INTERRUPT_DISPATCH_NONE
+#endif
+#ifndef INT1_DISPATCH
+#define INT1_DISPATCH INTERRUPT_DISPATCH_NONE
+#endif
+
+#ifndef PCINT0_DISPATCH
+#define PCINT0_DISPATCH INTERRUPT_DISPATCH_NONE
+#endif
+#ifndef PCINT1_DISPATCH
+#define PCINT1_DISPATCH INTERRUPT_DISPATCH_NONE
+#endif
+#ifndef PCINT2_DISPATCH
+#define PCINT2_DISPATCH INTERRUPT_DISPATCH_NONE
+#endif
+
+#define INTERRUPT_DISPATCH_DEFERRED_ANY \
+	(INT0_DISPATCH == INTERRUPT_DISPATCH_DEFERRED || INT1_DISPATCH == INTERRUPT_DISPATCH_DEFERRED || \
+	 PCINT0_DISPATCH == INTERRUPT_DISPATCH_DEFERRED || PCINT1_DISPATCH == INTERRUPT_DISPATCH_DEFERRED || \
+	 PCINT2_DISPATCH == INTERRUPT_DISPATCH_DEFERRED)
+
+// Level of the pin after the change
+#define PCINT_EDGE_FALLING 0
+#define PCINT_EDGE_RISING 1
+
+// Callback attached to a pin or an external interrupt, ctx is given back on
+// every call. Same signature as an event handler, so deferring costs nothing.
+typedef void (*pcint_callback_t)(uint8_t edge, void *ctx);
+
 /*
  * //////////////////////////////////////////////////////////////////////////
  *							Interrupt Functions
@@ -46,6 +103,10 @@ extern "C" {
  */ 
 void enable_interrupt(uint8_t interrupt, uint8_t mode);
 void enable_pcie(uint8_t port, uint8_t interrupt_pin);
+uint8_t interrupt_attach(uint8_t interrupt, uint8_t mode, pcint_callback_t callback, void *ctx);
+void interrupt_detach(uint8_t interrupt);
+uint8_t pcint_attach(uint8_t port, uint8_t pin, pcint_callback_t callback, void *ctx);
+void pcint_detach(uint8_t port, uint8_t pin);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,66 @@
+/*
+ * wait.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _WAIT_H_
+#define _WAIT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Wait Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Blocking calls that poll a flag can sleep instead, when the flag has an
+ * interrupt the module enables before waiting and turns off in its ISR:
+ *	UCSR0B |= (1 << RXCIE0);
+ *	WAIT_UNTIL(SLEEP_MODE_IDLE, UCSR0A & (1 << RXC0));
+ *
+ * Any interrupt wakes the CPU and the condition is tested again with
+ * interrupts disabled, and sei() + SLEEP are back to back so a wakeup
+ * between the test and the sleep is never lost. Called with interrupts
+ * off (an ISR, a CRITICAL_BLOCK()) nothing could wake the CPU, so the
+ * wait spins there like a plain poll. The sleep mode set by the caller
+ * (Scheduler, Tickless) is restored afterwards.
+ */
+#define WAIT_UNTIL(mode, cond) do { \
+	uint8_t _wait_sreg = SREG; \
+	if(!(_wait_sreg & (1 << SREG_I))) \
+	{ \
+		while(!(cond)); \
+		break; \
+	} \
+	uint8_t _wait_smcr = SMCR; \
+	set_sleep_mode(mode); \
+	cli(); \
+	while(!(cond)) \
+	{ \
+		sleep_enable(); \
+		sei(); \
+		sleep_cpu(); \
+		sleep_disable(); \
+		cli(); \
+	} \
+	SMCR = _wait_smcr; \
+	SREG = _wait_sreg; \
+} while(0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WAIT_H_ */
@@ -0,0 +1,95 @@
+/*
+ * critical.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Critical.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Critical Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+volatile uint8_t g_critical_depth;
+
+#if CRITICAL_INSTRUMENT
+
+#include "Millis.h"
+
+static uint32_t g_critical_start;							  // micros() at the outermost enter
+static volatile uint16_t g_critical_longest;				  // Microseconds
+static volatile uint16_t g_critical_latency[CRITICAL_VECTOR_COUNT]; // CPU cycles
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Critical Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Outermost Section opened, interrupts are already disabled */
+void critical_window_begin()
+{
+	g_critical_start = micros();
+}
+
+/* Outermost Section about to close, interrupts are still disabled */
+void critical_window_end()
+{
+	uint32_t window = micros() - g_critical_start;
+	
+	if(window > 0xFFFF)
+		window = 0xFFFF;
+	if(window > g_critical_longest)
+		g_critical_longest = window;
+}
+
+/* 
+ * Record the Entry Latency of a Vector, the CPU cycles between its event
+ * and the first instruction of the handler
+ */
+void critical_isr_latency(uint8_t vector, uint16_t cycles)
+{
+	if(vector < CRITICAL_VECTOR_COUNT && cycles > g_critical_latency[vector])
+		g_critical_latency[vector] = cycles;
+}
+
+/* Longest Interrupts-Disabled Window, in Microseconds (micros() resolution) */
+uint16_t critical_longest_window_us()
+{
+	uint16_t longest;
+	
+	CRITICAL_BLOCK()
+	{
+		longest = g_critical_longest;
+	}
+	return longest;
+}
+
+/* Worst Entry Latency of a Vector (e.g. TIMER1_COMPA_vect_num), in CPU Cycles */
+uint16_t critical_max_latency(uint8_t vector)
+{
+	uint16_t latency = 0;
+	
+	if(vector < CRITICAL_VECTOR_COUNT)
+	{
+		CRITICAL_BLOCK()
+		{
+			latency = g_critical_latency[vector];
+		}
+	}
+	return latency;
+}
+
+/* Clear the Recorded Maxima */
+void critical_instrument_reset()
+{
+	CRITICAL_BLOCK()
+	{
+		g_critical_longest = 0;
+		for(uint8_t i = 0; i < CRITICAL_VECTOR_COUNT; i++)
+			g_critical_latency[i] = 0;
+	}
+}
+
+#endif
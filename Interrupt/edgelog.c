@@ -0,0 +1,202 @@
+/*
+ * edgelog.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Interrupt.h"
+
+#if INTERRUPT_EDGE_LOG
+
+#include "EdgeLog.h"
+#include "Millis.h"
+#include "TIMER.h"
+#include "USART.h"
+
+#if EDGELOG_CLOCK == EDGELOG_CLOCK_TIMER1 && TIMER1_OVF_DISPATCH
+#error "Edge Log: EDGELOG_CLOCK_TIMER1 owns TIMER1_OVF_vect, leave TIMER1_OVF_DISPATCH compiled out"
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Edge Log Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Keeps the compiler from moving entry accesses across an index update
+#define EDGELOG_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
+static edgelog_entry_t g_edgelog[EDGELOG_SIZE];
+static volatile uint8_t g_edgelog_head; // Written by the interrupts only
+static volatile uint8_t g_edgelog_tail; // Written by the main loop only
+static volatile uint16_t g_edgelog_dropped;
+static volatile uint8_t g_edgelog_enabled; // Bit n: INTn is logged
+
+#if EDGELOG_CLOCK == EDGELOG_CLOCK_TIMER1
+static volatile uint32_t g_edgelog_overflows; // Timer 1 count above its 16 bits
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Edge Log Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Start the Timestamp Clock, Timer 1 with EDGELOG_CLOCK_TIMER1 */
+void init_edgelog()
+{
+#if EDGELOG_CLOCK == EDGELOG_CLOCK_TIMER1
+	stop_timer1();
+	g_edgelog_overflows = 0;
+
+	// Normal Mode
+	// (TCCR1A): TC1 Control Register A
+	TCCR1A = 0;
+	CRITICAL_BLOCK()
+	{
+		TCNT1 = 0;
+	}
+
+	// (TIMSK1): Overflow Interrupt
+	TIFR1 = (1 << TOV1);
+	TIMSK1 |= (1 << TOIE1);
+
+	// (TCCR1B): TC1 Control Register B, clk/8
+	TCCR1B = (TIMER1_PRESCALER_8 << CS10);
+	critical_sei();
+#endif
+}
+
+/* Microseconds now, called from the INTn interrupt with interrupts off */
+static inline uint32_t edgelog_now()
+{
+#if EDGELOG_CLOCK == EDGELOG_CLOCK_TIMER1
+	uint16_t low = TCNT1;
+	uint32_t high = g_edgelog_overflows;
+
+	// Overflow not serviced yet, the low word has already wrapped
+	if((TIFR1 & (1 << TOV1)) && low < 0x8000)
+		high++;
+
+	// Ticks in microseconds, wrapping at 2^32 like micros()
+	return (high << (16 - EDGELOG_TICK_SHIFT)) | (low >> EDGELOG_TICK_SHIFT);
+#else
+	return micros();
+#endif
+}
+
+/* Start Logging an External Interrupt */
+void edgelog_enable(uint8_t interrupt)
+{
+	if(interrupt <= 1)
+		g_edgelog_enabled |= (1 << interrupt);
+}
+
+/* Stop Logging an External Interrupt */
+void edgelog_disable(uint8_t interrupt)
+{
+	if(interrupt <= 1)
+		g_edgelog_enabled &= ~(1 << interrupt);
+}
+
+/* 
+ * Log an Edge, called by the INTn dispatcher
+ * A full log keeps the oldest entries and counts the lost ones
+ */
+void edgelog_record(uint8_t interrupt, uint8_t level)
+{
+	if(!(g_edgelog_enabled & (1 << interrupt)))
+		return;
+
+	uint32_t us = edgelog_now();
+
+	uint8_t head = g_edgelog_head;
+	uint8_t next = (head + 1) & (EDGELOG_SIZE - 1);
+
+	if(next == g_edgelog_tail)
+	{
+		g_edgelog_dropped++;
+		return;
+	}
+
+	g_edgelog[head].us = us;
+	g_edgelog[head].source = interrupt | (level ? EDGELOG_RISING : 0);
+
+	EDGELOG_BARRIER();
+	g_edgelog_head = next;
+}
+
+/* 
+ * Take the Oldest Entry
+ * Returns '0' if the log is empty
+ */
+uint8_t edgelog_read(edgelog_entry_t *entry)
+{
+	uint8_t tail = g_edgelog_tail;
+
+	if(tail == g_edgelog_head)
+		return 0;
+
+	EDGELOG_BARRIER();
+	*entry = g_edgelog[tail];
+
+	EDGELOG_BARRIER();
+	g_edgelog_tail = (tail + 1) & (EDGELOG_SIZE - 1);
+	return 1;
+}
+
+/* Entries waiting to be read */
+uint8_t edgelog_count()
+{
+	return (g_edgelog_head - g_edgelog_tail) & (EDGELOG_SIZE - 1);
+}
+
+/* Edges lost to a full log */
+uint16_t edgelog_dropped()
+{
+	uint16_t dropped;
+	
+	CRITICAL_BLOCK()
+	{
+		dropped = g_edgelog_dropped;
+	}
+	return dropped;
+}
+
+/* 
+ * Drain the Log over the USART, one edge per line
+ * INTn R|F <micros> <microseconds since the previous edge>
+ * Call it from the main loop to stream the edges as they come
+ */
+void edgelog_print()
+{
+	static uint32_t last_us;
+	edgelog_entry_t entry;
+	char buffer[11];
+
+	while(edgelog_read(&entry))
+	{
+		put_string((entry.source & EDGELOG_INTERRUPT_MASK) ? "INT1 " : "INT0 ");
+		put_string((entry.source & EDGELOG_RISING) ? "R " : "F ");
+		put_string(ultoa(entry.us, buffer, 10));
+		put_string(" ");
+		put_string(ultoa(entry.us - last_us, buffer, 10));
+		print_line();
+		
+		last_us = entry.us;
+	}
+}
+
+#if EDGELOG_CLOCK == EDGELOG_CLOCK_TIMER1
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Edge Log Interrupts
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timestamp Clock Upper Bits
+ISR(TIMER1_OVF_vect)
+{
+	g_edgelog_overflows++;
+}
+#endif
+
+#endif
@@ -4,7 +4,38 @@
  * Created: 6/18/2019 
  * Author: Miguel Osuna
  */ 
-#include "interrupt.h"
+#include "Interrupt.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Interrupt Dispatch Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Callback and context attached to INT0 and INT1
+static struct
+{
+	pcint_callback_t callback;
+	void *ctx;
+} g_interrupt_vectors[2];
+
+// External interrupts compiled into this file, interrupt_attach() refuses the others
+static const uint8_t g_interrupt_dispatch[2] = { INT0_DISPATCH, INT1_DISPATCH };
+
+// Callback and context attached to each pin of each port
+static struct
+{
+	pcint_callback_t callback;
+	void *ctx;
+} g_pcint_pins[3][8];
+
+// Pin levels seen by the last interrupt of each port
+static uint8_t g_pcint_last[3];
+
+// Ports compiled into this file, pcint_attach() refuses the others
+static const uint8_t g_pcint_dispatch[3] = { PCINT0_DISPATCH, PCINT1_DISPATCH, PCINT2_DISPATCH };
+
+// Lowest set bit of a nibble
+static const uint8_t g_pcint_first_bit[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
 
 /*
  * //////////////////////////////////////////////////////////////////////////
@@ -21,9 +52,16 @@
  * '01': Any logical change on INT generates an interrupt request
  * '10': The falling edge of INT generates an interrupt request
  * '11': The rising edge of INT generates an interrupt request
+ * INTERRUPT_MODE_LOG: Also log every edge with its time
  */
 void enable_interrupt(uint8_t interrupt, uint8_t mode)
 {
+#if INTERRUPT_EDGE_LOG
+	if(mode & INTERRUPT_MODE_LOG)
+		edgelog_enable(interrupt);
+#endif
+	mode &= 0x03;
+
 	// (EICRA): External Interrupt Control Register A
 	// (ISC1n): Interrupt Sense Control [n = 1:0]
 
@@ -36,7 +74,7 @@ void enable_interrupt(uint8_t interrupt, uint8_t mode)
 	if(!interrupt)
 		EICRA |= (mode << ISC00);
 		
-	sei(); // Set Global Interrupt Enable Bit
+	critical_sei(); // Set Global Interrupt Enable Bit
 }
 
 /* 
@@ -81,5 +119,262 @@ void enable_pcie(uint8_t port, uint8_t interrupt_pin)
 			PCMSK0 |= (1 << interrupt_pin);
 			break;
 	}
-	sei();
-}
\ No newline at end of file
+	critical_sei();
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Interrupt Dispatch Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Attach a Callback to an External Interrupt and Enable it
+ * interrupt: EXTERNAL_INTERRUPT_REQUEST_0 (PD2) or _1 (PD3)
+ * mode: INTERRUPT_MODE_xxx, the callback gets the pin level
+ * Returns '0' if the vector is compiled out (INTn_DISPATCH)
+ */
+uint8_t interrupt_attach(uint8_t interrupt, uint8_t mode, pcint_callback_t callback, void *ctx)
+{
+	if(interrupt > 1 || !callback || !g_interrupt_dispatch[interrupt])
+		return 0;
+
+#if INTERRUPT_EDGE_LOG
+	if(mode & INTERRUPT_MODE_LOG)
+		edgelog_enable(interrupt);
+#endif
+	mode &= 0x03;
+
+	// (ISCn1:0) sit two bits apart for each interrupt
+	uint8_t shift = interrupt ? ISC10 : ISC00;
+
+	CRITICAL_BLOCK()
+	{
+		g_interrupt_vectors[interrupt].callback = callback;
+		g_interrupt_vectors[interrupt].ctx = ctx;
+
+		// (EICRA): External Interrupt Control Register A
+		EICRA = (EICRA & ~(0x03 << shift)) | (mode << shift);
+		
+		// (EIFR): External Interrupt Flag Register, clear a stale flag
+		EIFR = (1 << interrupt);
+		EIMSK |= (1 << interrupt);
+	}
+	critical_sei();
+	return 1;
+}
+
+/* Disable an External Interrupt and Detach its Callback */
+void interrupt_detach(uint8_t interrupt)
+{
+	if(interrupt > 1)
+		return;
+
+	CRITICAL_BLOCK()
+	{
+		EIMSK &= ~(1 << interrupt);
+		g_interrupt_vectors[interrupt].callback = 0;
+		g_interrupt_vectors[interrupt].ctx = 0;
+	}
+}
+
+/* Input Register of a Port */
+static volatile uint8_t *pcint_port_pins(uint8_t port)
+{
+	switch(port)
+	{
+		case PIN_CHANGE_INTERRUPT_1: return &PINC;
+		case PIN_CHANGE_INTERRUPT_2: return &PIND;
+		default: return &PINB;
+	}
+}
+
+/* Mask Register of a Port */
+static volatile uint8_t *pcint_port_mask(uint8_t port)
+{
+	switch(port)
+	{
+		case PIN_CHANGE_INTERRUPT_1: return &PCMSK1;
+		case PIN_CHANGE_INTERRUPT_2: return &PCMSK2;
+		default: return &PCMSK0;
+	}
+}
+
+/* 
+ * Attach a Callback to a Pin and Enable its Pin Change Interrupt
+ * Port '0': Port B, '1': Port C, '2': Port D
+ * Returns '0' if the port is compiled out (PCINTn_DISPATCH)
+ */
+uint8_t pcint_attach(uint8_t port, uint8_t pin, pcint_callback_t callback, void *ctx)
+{
+	if(port > 2 || pin > 7 || !callback || !g_pcint_dispatch[port])
+		return 0;
+
+	uint8_t bit = (1 << pin);
+
+	CRITICAL_BLOCK()
+	{
+		g_pcint_pins[port][pin].callback = callback;
+		g_pcint_pins[port][pin].ctx = ctx;
+
+		// Start from the current level, so only later changes are reported
+		g_pcint_last[port] = (g_pcint_last[port] & ~bit) | (*pcint_port_pins(port) & bit);
+	}
+	enable_pcie(port, pin);
+	return 1;
+}
+
+/* Mask a Pin and Detach its Callback, the port is disabled with its last pin */
+void pcint_detach(uint8_t port, uint8_t pin)
+{
+	if(port > 2 || pin > 7)
+		return;
+
+	volatile uint8_t *pcmsk = pcint_port_mask(port);
+
+	CRITICAL_BLOCK()
+	{
+		*pcmsk &= ~(1 << pin);
+		if(!*pcmsk)
+			PCICR &= ~(1 << port);
+		
+		g_pcint_pins[port][pin].callback = 0;
+		g_pcint_pins[port][pin].ctx = 0;
+	}
+}
+
+#if INTERRUPT_DISPATCH_DEFERRED_ANY
+/* 
+ * Run a Deferred Pin Change from event_dispatch()
+ * arg is (port << 4) | (pin << 1) | level, the callback is the one attached now
+ */
+static void pcint_deferred(uint8_t arg, void *ctx)
+{
+	uint8_t port = arg >> 4;
+	uint8_t pin = (arg >> 1) & 0x07;
+	pcint_callback_t callback;
+
+	CRITICAL_BLOCK()
+	{
+		callback = g_pcint_pins[port][pin].callback;
+		ctx = g_pcint_pins[port][pin].ctx;
+	}
+
+	// Detached while the event was queued
+	if(callback)
+		callback(arg & 1, ctx);
+}
+
+/* 
+ * Run a Deferred External Interrupt from event_dispatch()
+ * arg is (interrupt << 1) | level
+ */
+static void interrupt_deferred(uint8_t arg, void *ctx)
+{
+	uint8_t interrupt = arg >> 1;
+	pcint_callback_t callback;
+
+	CRITICAL_BLOCK()
+	{
+		callback = g_interrupt_vectors[interrupt].callback;
+		ctx = g_interrupt_vectors[interrupt].ctx;
+	}
+
+	if(callback)
+		callback(arg & 1, ctx);
+}
+#endif
+
+/* 
+ * Dispatch the Changes of a Port
+ * The snapshot XOR the last one gives the changed pins, each is found by
+ * table lookup, so the cost follows the changed pins and not the attached ones
+ */
+static inline void pcint_dispatch(uint8_t port, uint8_t pins, uint8_t mask, uint8_t deferred)
+{
+	uint8_t changed = (pins ^ g_pcint_last[port]) & mask;
+	g_pcint_last[port] = pins;
+
+	while(changed)
+	{
+		uint8_t pin = (changed & 0x0F) ? g_pcint_first_bit[changed & 0x0F] : 4 + g_pcint_first_bit[changed >> 4];
+		changed &= changed - 1;
+		
+		// Pins enabled with enable_pcie() alone have no callback
+		pcint_callback_t callback = g_pcint_pins[port][pin].callback;
+		if(!callback)
+			continue;
+
+#if INTERRUPT_DISPATCH_DEFERRED_ANY
+		if(deferred)
+		{
+			event_post(pcint_deferred, (port << 4) | (pin << 1) | ((pins >> pin) & 1), 0);
+			continue;
+		}
+#else
+		(void) deferred;
+#endif
+		callback((pins >> pin) & 1, g_pcint_pins[port][pin].ctx);
+	}
+}
+
+/* External Interrupts, compiled in with INTn_DISPATCH */
+static inline void interrupt_dispatch(uint8_t interrupt, uint8_t level, uint8_t deferred)
+{
+	pcint_callback_t callback = g_interrupt_vectors[interrupt].callback;
+
+#if INTERRUPT_EDGE_LOG
+	edgelog_record(interrupt, level);
+#endif
+
+	// Enabled with enable_interrupt() alone, e.g. only to be logged
+	if(!callback)
+		return;
+
+#if INTERRUPT_DISPATCH_DEFERRED_ANY
+	if(deferred)
+	{
+		event_post(interrupt_deferred, (interrupt << 1) | level, 0);
+		return;
+	}
+#else
+	(void) deferred;
+#endif
+	callback(level, g_interrupt_vectors[interrupt].ctx);
+}
+
+#if INT0_DISPATCH
+ISR(INT0_vect)
+{
+	interrupt_dispatch(0, (PIND >> PIND2) & 1, INT0_DISPATCH == INTERRUPT_DISPATCH_DEFERRED);
+}
+#endif
+
+#if INT1_DISPATCH
+ISR(INT1_vect)
+{
+	interrupt_dispatch(1, (PIND >> PIND3) & 1, INT1_DISPATCH == INTERRUPT_DISPATCH_DEFERRED);
+}
+#endif
+
+/* Pin Change Interrupts, compiled in with PCINTn_DISPATCH */
+#if PCINT0_DISPATCH
+ISR(PCINT0_vect)
+{
+	pcint_dispatch(PIN_CHANGE_INTERRUPT_0, PINB, PCMSK0, PCINT0_DISPATCH == INTERRUPT_DISPATCH_DEFERRED);
+}
+#endif
+
+#if PCINT1_DISPATCH
+ISR(PCINT1_vect)
+{
+	pcint_dispatch(PIN_CHANGE_INTERRUPT_1, PINC, PCMSK1, PCINT1_DISPATCH == INTERRUPT_DISPATCH_DEFERRED);
+}
+#endif
+
+#if PCINT2_DISPATCH
+ISR(PCINT2_vect)
+{
+	pcint_dispatch(PIN_CHANGE_INTERRUPT_2, PIND, PCMSK2, PCINT2_DISPATCH == INTERRUPT_DISPATCH_DEFERRED);
+}
+#endif
\ No newline at end of file
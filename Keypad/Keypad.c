@@ -0,0 +1,211 @@
+/*
+ * keypad.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Keypad.h"
+#include "Ring.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Keypad Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+typedef struct
+{
+	volatile uint8_t *reg; // DDRx for rows, PINx for columns
+	uint8_t mask;
+} keypad_pin_t;
+
+static keypad_pin_t g_keypad_rows[KEYPAD_MAX_ROWS];
+static keypad_pin_t g_keypad_columns[KEYPAD_MAX_COLUMNS];
+static uint8_t g_keypad_row_count;
+static uint8_t g_keypad_column_count;
+static uint8_t g_keypad_row; // Row driven now
+
+// Per row, bit n is column n. Two-bit vertical counters debounce each key.
+static uint8_t g_keypad_state[KEYPAD_MAX_ROWS];	   // Debounced, '1': Pressed
+static uint8_t g_keypad_reported[KEYPAD_MAX_ROWS]; // Last state sent as events
+static uint8_t g_keypad_cnt0[KEYPAD_MAX_ROWS];
+static uint8_t g_keypad_cnt1[KEYPAD_MAX_ROWS];
+static volatile uint8_t g_keypad_ghost;
+
+// keypad_tick() puts and keypad_read() gets
+static uint8_t g_keypad_buffer[KEYPAD_QUEUE_SIZE];
+static ring_t g_keypad_queue = RING_INIT(g_keypad_buffer);
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Keypad Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Register of a Pin: '0': DDRx, '1': PORTx, '2': PINx */
+static volatile uint8_t *keypad_register(uint8_t pin, uint8_t reg)
+{
+	switch(pin >> 3)
+	{
+		case KEYPAD_PORT_B: return (reg == 0) ? &DDRB : (reg == 1) ? &PORTB : &PINB;
+		case KEYPAD_PORT_C: return (reg == 0) ? &DDRC : (reg == 1) ? &PORTC : &PINC;
+		default: return (reg == 0) ? &DDRD : (reg == 1) ? &PORTD : &PIND;
+	}
+}
+
+/* 
+ * Initialize the Keypad, rows and columns given with KEYPAD_PIN()
+ * Idle rows float, the driven one is pulled low, so a pressed key pulls its
+ * column low without shorting two rows together
+ * Returns '0' if the matrix is too large
+ */
+uint8_t init_keypad(const uint8_t *rows, uint8_t row_count, const uint8_t *columns, uint8_t column_count)
+{
+	if(!row_count || row_count > KEYPAD_MAX_ROWS || !column_count || column_count > KEYPAD_MAX_COLUMNS)
+		return 0;
+
+	CRITICAL_BLOCK()
+	{
+		for(uint8_t i = 0; i < row_count; i++)
+		{
+			uint8_t mask = (1 << (rows[i] & 0x07));
+			g_keypad_rows[i].reg = keypad_register(rows[i], 0);
+			g_keypad_rows[i].mask = mask;
+
+			// Input, no pull-up; PORTx low for when it is driven
+			*g_keypad_rows[i].reg &= ~mask;
+			*keypad_register(rows[i], 1) &= ~mask;
+			
+			g_keypad_state[i] = 0;
+			g_keypad_reported[i] = 0;
+			g_keypad_cnt0[i] = 0;
+			g_keypad_cnt1[i] = 0;
+		}
+
+		for(uint8_t i = 0; i < column_count; i++)
+		{
+			uint8_t mask = (1 << (columns[i] & 0x07));
+			g_keypad_columns[i].reg = keypad_register(columns[i], 2);
+			g_keypad_columns[i].mask = mask;
+
+			// Input with Pull-up
+			*keypad_register(columns[i], 0) &= ~mask;
+			*keypad_register(columns[i], 1) |= mask;
+		}
+
+		g_keypad_row_count = row_count;
+		g_keypad_column_count = column_count;
+		g_keypad_row = 0;
+		g_keypad_ghost = 0;
+		
+		// Drive the first row, it settles until the next tick
+		*g_keypad_rows[0].reg |= g_keypad_rows[0].mask;
+	}
+	return 1;
+}
+
+/* Queue a Key Event, a full queue drops it */
+static inline void keypad_emit(uint8_t key)
+{
+	ring_put(&g_keypad_queue, key);
+}
+
+/* 
+ * End of a Full Scan
+ * Without diodes, three keys on the corners of a rectangle make the fourth
+ * look pressed. Two rows sharing two or more pressed columns can be such a
+ * ghost, so new presses are held back until the matrix is unambiguous.
+ * Releases are always sent.
+ */
+static void keypad_scan_done()
+{
+	uint8_t ghost = 0;
+
+	for(uint8_t a = 0; a < g_keypad_row_count; a++)
+	{
+		for(uint8_t b = a + 1; b < g_keypad_row_count; b++)
+		{
+			uint8_t common = g_keypad_state[a] & g_keypad_state[b];
+			
+			// More than one bit set
+			if(common & (common - 1))
+				ghost = 1;
+		}
+	}
+	g_keypad_ghost = ghost;
+
+	for(uint8_t row = 0; row < g_keypad_row_count; row++)
+	{
+		uint8_t reported = g_keypad_reported[row];
+		uint8_t changed = g_keypad_state[row] ^ reported;
+		if(ghost)
+			changed &= reported;
+		if(!changed)
+			continue;
+
+		uint8_t key = row * g_keypad_column_count;
+		for(uint8_t column = 0; column < g_keypad_column_count; column++, key++)
+		{
+			uint8_t bit = (1 << column);
+			if(changed & bit)
+				keypad_emit((reported & bit) ? (key | KEYPAD_RELEASED) : key);
+		}
+		g_keypad_reported[row] = reported ^ changed;
+	}
+}
+
+/* 
+ * Scan one Row, timer_callback_t compatible
+ * Reads the columns of the driven row, debounces them and drives the next
+ */
+void keypad_tick(void *ctx)
+{
+	uint8_t row = g_keypad_row;
+	uint8_t count = g_keypad_row_count;
+	
+	if(!count)
+		return;
+
+	// Pressed keys pull their column low
+	uint8_t sample = 0;
+	for(uint8_t column = 0; column < g_keypad_column_count; column++)
+	{
+		if(!(*g_keypad_columns[column].reg & g_keypad_columns[column].mask))
+			sample |= (1 << column);
+	}
+
+	// Vertical counters, a key toggles after four differing samples
+	uint8_t state = g_keypad_state[row];
+	uint8_t cnt0 = g_keypad_cnt0[row];
+	uint8_t delta = sample ^ state;
+	uint8_t cnt1 = (g_keypad_cnt1[row] ^ cnt0) & delta;
+	cnt0 = ~cnt0 & delta;
+	
+	g_keypad_cnt0[row] = cnt0;
+	g_keypad_cnt1[row] = cnt1;
+	g_keypad_state[row] = state ^ (delta & ~(cnt0 | cnt1));
+
+	// Float this row and drive the next one
+	*g_keypad_rows[row].reg &= ~g_keypad_rows[row].mask;
+	if(++row >= count)
+		row = 0;
+	*g_keypad_rows[row].reg |= g_keypad_rows[row].mask;
+	g_keypad_row = row;
+
+	if(row == 0)
+		keypad_scan_done();
+}
+
+/* 
+ * Take the Oldest Key Event
+ * Returns '0' if there is none
+ */
+uint8_t keypad_read(uint8_t *key)
+{
+	return ring_get(&g_keypad_queue, key);
+}
+
+/* '1' while the pressed keys are ambiguous and new presses are held back */
+uint8_t keypad_ghosting()
+{
+	return g_keypad_ghost;
+}
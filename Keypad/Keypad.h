@@ -0,0 +1,66 @@
+/*
+ * keypad.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _KEYPAD_H_
+#define _KEYPAD_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include "Critical.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Keypad Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// keypad_tick() drives one row low and reads the columns (inputs with
+// pull-ups) per call, from a timer tick. Each key is debounced over four
+// scans of its row, so a 4 row keypad on a 1 ms tick settles in 16 ms.
+#define KEYPAD_MAX_ROWS 4
+#define KEYPAD_MAX_COLUMNS 8
+
+// Pin of a row or column, Port '0': Port B, '1': Port C, '2': Port D
+#define KEYPAD_PIN(port, pin) (((port) << 3) | (pin))
+
+#define KEYPAD_PORT_B 0
+#define KEYPAD_PORT_C 1
+#define KEYPAD_PORT_D 2
+
+// Key codes are row * columns + column, with this bit set on release
+#define KEYPAD_RELEASED 0x80
+
+// Queued key events, power of two
+#ifndef KEYPAD_QUEUE_SIZE
+#define KEYPAD_QUEUE_SIZE 16
+#endif
+
+#if (KEYPAD_QUEUE_SIZE & (KEYPAD_QUEUE_SIZE - 1)) != 0 || KEYPAD_QUEUE_SIZE > 256
+#error "Keypad: KEYPAD_QUEUE_SIZE must be a power of two up to 256"
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Keypad Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+uint8_t init_keypad(const uint8_t *rows, uint8_t row_count, const uint8_t *columns, uint8_t column_count);
+void keypad_tick(void *ctx);
+uint8_t keypad_read(uint8_t *key);
+uint8_t keypad_ghosting();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _KEYPAD_H_ */
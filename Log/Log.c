@@ -0,0 +1,176 @@
+/*
+ * log.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#include "Log.h"
+#include "Wait.h"
+
+#if USART_SLEEP_WAIT_TX
+#error "Log: Log.c owns USART_UDRE_vect, build with USART_SLEEP_WAIT_TX=0"
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Log Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */
+// Sync, ID and argument byte count ahead of the arguments
+#define LOG_HEADER_SIZE 3
+#define LOG_MASK (LOG_BUFFER_SIZE - 1)
+
+static uint8_t g_log_buffer[LOG_BUFFER_SIZE];
+static volatile uint8_t g_log_head; // Written by log_write() only
+static volatile uint8_t g_log_tail; // Written by the UDRE ISR only
+static volatile uint16_t g_log_dropped;
+static uint16_t g_log_unreported;	// Drops not sent as LOG_DROPPED yet
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Log Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+
+/* Bytes the Ring can still take, one slot stays empty */
+static inline uint8_t log_free()
+{
+	return (uint8_t) ((g_log_tail - g_log_head - 1) & LOG_MASK);
+}
+
+/* Append one record, the caller checked the room */
+static inline void log_put(uint8_t id, const uint8_t *data, uint8_t size)
+{
+	uint8_t head = g_log_head;
+
+	g_log_buffer[head] = LOG_SYNC;
+	head = (head + 1) & LOG_MASK;
+	g_log_buffer[head] = id;
+	head = (head + 1) & LOG_MASK;
+	g_log_buffer[head] = size;
+	head = (head + 1) & LOG_MASK;
+
+	while(size--)
+	{
+		g_log_buffer[head] = *data++;
+		head = (head + 1) & LOG_MASK;
+	}
+	g_log_head = head;
+}
+
+/* Send the next byte, '0' once the ring is empty */
+static inline uint8_t log_send()
+{
+	uint8_t tail = g_log_tail;
+
+	if(tail == g_log_head)
+		return 0;
+
+	UDR0 = g_log_buffer[tail];
+	g_log_tail = (tail + 1) & LOG_MASK;
+	return 1;
+}
+
+/* Empty the Ring, the USART has to be set up with init_usart() */
+void init_log()
+{
+	CRITICAL_BLOCK()
+	{
+		// (UDRIE0): Data Register Empty Interrupt, on while records wait
+		UCSR0B &= ~(1 << UDRIE0);
+		g_log_head = 0;
+		g_log_tail = 0;
+		g_log_dropped = 0;
+		g_log_unreported = 0;
+	}
+}
+
+/*
+ * Queue a Record, callable from the main loop and from interrupts
+ * Returns '0' and counts a drop if the record does not fit
+ */
+uint8_t log_write(uint8_t id, const void *args, uint8_t size)
+{
+	uint8_t written = 0;
+
+	CRITICAL_BLOCK()
+	{
+		uint8_t room = log_free();
+
+		// Report earlier drops first, so the decoder sees where the gap is
+		if(g_log_unreported)
+		{
+			if(room < 2 * LOG_HEADER_SIZE + sizeof(g_log_unreported) + size)
+			{
+				if(g_log_unreported != 0xFFFF)
+					g_log_unreported++;
+				if(g_log_dropped != 0xFFFF)
+					g_log_dropped++;
+				break;
+			}
+
+			log_put(LOG_DROPPED, (const uint8_t *) &g_log_unreported, sizeof(g_log_unreported));
+			g_log_unreported = 0;
+		}
+		else if(room < LOG_HEADER_SIZE + size)
+		{
+			g_log_unreported = 1;
+			if(g_log_dropped != 0xFFFF)
+				g_log_dropped++;
+			break;
+		}
+
+		log_put(id, (const uint8_t *) args, size);
+		UCSR0B |= (1 << UDRIE0);
+		written = 1;
+	}
+	return written;
+}
+
+/*
+ * Wait until every Record is handed to the USART
+ * With interrupts off the ring is drained here by polling UDRE0
+ */
+void log_flush()
+{
+	if(SREG & (1 << SREG_I))
+	{
+		WAIT_UNTIL(SLEEP_MODE_IDLE, g_log_tail == g_log_head);
+		return;
+	}
+
+	do
+	{
+		while(!(UCSR0A & (1 << UDRE0)));
+	} while(log_send());
+}
+
+/* Bytes waiting to be sent */
+uint8_t log_pending()
+{
+	return (uint8_t) ((g_log_head - g_log_tail) & LOG_MASK);
+}
+
+/* Records lost to a full ring since init_log() */
+uint16_t log_dropped()
+{
+	uint16_t dropped;
+
+	CRITICAL_BLOCK()
+	{
+		dropped = g_log_dropped;
+	}
+	return dropped;
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Log Interrupts
+ * //////////////////////////////////////////////////////////////////////////
+ */
+// One byte per Data Register Empty, the interrupt goes off with the ring
+ISR(USART_UDRE_vect)
+{
+	if(!log_send())
+		UCSR0B &= ~(1 << UDRIE0);
+}
@@ -0,0 +1,108 @@
+/*
+ * log.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _LOG_H_
+#define _LOG_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include "Critical.h"
+#include "USART.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Log Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Binary deferred logging. A call site stores a message ID and its raw
+ * arguments in a RAM ring buffer, USART_UDRE_vect drains it in the
+ * background and log_decode.py rebuilds the text on the host from the
+ * same message table:
+ *	LOG_MESSAGE(LOG_ADC_READING, "adc%u = %u")		// log_messages.def
+ *	LOG2(LOG_ADC_READING, channel, value);			// call site
+ *
+ * Each record is LOG_SYNC, the ID, the argument byte count and the
+ * arguments, little-endian. LOGn() arguments are 16-bit ("%u", "%d",
+ * "%x", "%c"), LOG_LONG() takes one 32-bit argument ("%lu", "%ld").
+ * A record that does not fit is dropped and counted, the count is sent
+ * as LOG_DROPPED ahead of the next record that fits.
+ *
+ * init_usart() sets the baud rate. Log.c owns USART_UDRE_vect, so
+ * tx_byte() must not be used next to it and USART_SLEEP_WAIT_TX has to
+ * stay 0.
+ */
+// Message table, an X-macro list of LOG_MESSAGE(id, "format") lines
+#ifndef LOG_MESSAGES
+#define LOG_MESSAGES "log_messages.def"
+#endif
+
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE 128
+#endif
+
+#if (LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) != 0 || LOG_BUFFER_SIZE > 256
+#error "Log: LOG_BUFFER_SIZE must be a power of two up to 256"
+#endif
+
+// Record start, lets the decoder find the next record after a bad byte
+#define LOG_SYNC 0xA5
+
+// Message IDs: LOG_DROPPED first (also known to log_decode.py), then the table
+#define LOG_MESSAGE(id, format) id,
+typedef enum
+{
+	LOG_DROPPED,
+#include LOG_MESSAGES
+	LOG_MESSAGE_COUNT
+} log_id_t;
+#undef LOG_MESSAGE
+
+#define LOG(id) log_write((id), 0, 0)
+
+#define LOG1(id, a) do { \
+	uint16_t _log_args[1] = { (uint16_t) (a) }; \
+	log_write((id), _log_args, sizeof(_log_args)); \
+} while(0)
+
+#define LOG2(id, a, b) do { \
+	uint16_t _log_args[2] = { (uint16_t) (a), (uint16_t) (b) }; \
+	log_write((id), _log_args, sizeof(_log_args)); \
+} while(0)
+
+#define LOG3(id, a, b, c) do { \
+	uint16_t _log_args[3] = { (uint16_t) (a), (uint16_t) (b), (uint16_t) (c) }; \
+	log_write((id), _log_args, sizeof(_log_args)); \
+} while(0)
+
+#define LOG_LONG(id, a) do { \
+	uint32_t _log_arg = (uint32_t) (a); \
+	log_write((id), &_log_arg, sizeof(_log_arg)); \
+} while(0)
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Log Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */
+void init_log();
+uint8_t log_write(uint8_t id, const void *args, uint8_t size);
+void log_flush();
+uint8_t log_pending();
+uint16_t log_dropped();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _LOG_H_ */
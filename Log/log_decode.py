@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+#
+# log_decode.py
+#
+# Created: 10/18/2026
+# Author: Miguel Osuna
+#
+# Rebuilds the text of binary Log records (Log.h) on the host.
+#	log_decode.py capture.bin [--messages log_messages.def]
+#	log_decode.py --port /dev/ttyUSB0 [--baud 115200]	(needs pyserial)
+#	log_decode.py --table
+#
+# The ID table is generated from the same LOG_MESSAGE() list the firmware
+# was built with, in line order after the built-in LOG_DROPPED. A record
+# is LOG_SYNC, ID, argument byte count and little-endian arguments; one
+# that does not match its format is skipped up to the next LOG_SYNC.
+#
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+LOG_SYNC = 0xA5
+
+# Built-in messages ahead of the table, as in the log_id_t enum
+BUILTIN = [("LOG_DROPPED", "(%u records dropped)")]
+
+MESSAGE = re.compile(r'LOG_MESSAGE\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+COMMENT = re.compile(r"/\*.*?\*/|//[^\n]*", re.S)
+
+# printf conversion: flags and width, 'l' for 32-bit, conversion
+SPEC = re.compile(r"%([-+ #0]*\d*)(l?)([udxXc%])")
+
+def load_table(path):
+	with open(path) as f:
+		text = COMMENT.sub("", f.read())
+
+	table = list(BUILTIN)
+	for name, fmt in MESSAGE.findall(text):
+		table.append((name, bytes(fmt, "utf-8").decode("unicode_escape")))
+	return table
+
+def arguments(fmt):
+	# (size, signed) of each argument of a format
+	args = []
+	for flags, long, conv in SPEC.findall(fmt):
+		if conv != "%":
+			args.append((4 if long else 2, conv == "d"))
+	return args
+
+def render(fmt, data):
+	values = []
+	offset = 0
+	for size, signed in arguments(fmt):
+		code = ("<i" if signed else "<I") if size == 4 else ("<h" if signed else "<H")
+		values.append(struct.unpack_from(code, data, offset)[0])
+		offset += size
+
+	values = iter(values)
+	def convert(match):
+		flags, long, conv = match.groups()
+		if conv == "%":
+			return "%"
+		value = next(values)
+		if conv == "c":
+			return ("%" + flags + "c") % chr(value & 0xFF)
+		return ("%" + flags + conv) % value
+	return SPEC.sub(convert, fmt)
+
+def decode(stream, table):
+	# Yields (name, text) per record, resyncs on LOG_SYNC after bad data
+	buffer = bytearray()
+	for chunk in stream:
+		buffer.extend(chunk)
+		while True:
+			start = buffer.find(LOG_SYNC)
+			if start < 0:
+				buffer.clear()
+				break
+			del buffer[:start]
+			if len(buffer) < 3:
+				break
+
+			id, size = buffer[1], buffer[2]
+			if id >= len(table) or size != sum(s for s, _ in arguments(table[id][1])):
+				del buffer[:1]
+				continue
+			if len(buffer) < 3 + size:
+				break
+
+			name, fmt = table[id]
+			yield name, render(fmt, bytes(buffer[3:3 + size]))
+			del buffer[:3 + size]
+
+def file_chunks(path):
+	f = sys.stdin.buffer if path == "-" else open(path, "rb")
+	while True:
+		chunk = f.read(4096)
+		if not chunk:
+			break
+		yield chunk
+
+def serial_chunks(port, baud):
+	import serial
+	with serial.Serial(port, baud, timeout=0.1) as device:
+		while True:
+			chunk = device.read(256)
+			if chunk:
+				yield chunk
+
+def main():
+	parser = argparse.ArgumentParser(description="decode binary Log records")
+	parser.add_argument("input", nargs="?", default="-", help="capture file, - for stdin")
+	parser.add_argument("--messages", default=os.path.join(HERE, "log_messages.def"))
+	parser.add_argument("--port", help="read from a serial port instead")
+	parser.add_argument("--baud", type=int, default=115200)
+	parser.add_argument("--table", action="store_true", help="print the ID table and exit")
+	args = parser.parse_args()
+
+	table = load_table(args.messages)
+	if args.table:
+		for id, (name, fmt) in enumerate(table):
+			print("%3u\t%s\t%s" % (id, name, fmt))
+		return 0
+
+	chunks = serial_chunks(args.port, args.baud) if args.port else file_chunks(args.input)
+	try:
+		for name, text in decode(chunks, table):
+			print(text, flush=True)
+	except KeyboardInterrupt:
+		pass
+	return 0
+
+if __name__ == "__main__":
+	sys.exit(main())
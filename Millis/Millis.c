@@ -0,0 +1,124 @@
+/*
+ * millis.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Millis.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Millis Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+static volatile uint32_t g_millis;		 // Milliseconds since init_millis()
+static volatile uint16_t g_millis_epoch; // Times g_millis wrapped around (every ~49.7 days)
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Millis Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Takes a consistent snapshot of the timebase
+ * Returns the Timer 0 ticks elapsed inside the current millisecond
+ */
+static inline uint8_t read_timebase(uint16_t *epoch, uint32_t *ms)
+{
+	uint8_t ticks;
+
+	// Multi-byte counters are only coherent with interrupts disabled
+	// The critical section instrumentation timestamps through micros(), so
+	// the timebase keeps the uninstrumented ATOMIC_BLOCK
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		*epoch = g_millis_epoch;
+		*ms = g_millis;
+		ticks = TCNT0;
+
+		// (TIFR0): TC0 Interrupt Flag Register
+		// (OCF0A): Output Compare A Match Flag
+		// The counter already wrapped but the ISR has not run yet
+		if(TIFR0 & (1 << OCF0A))
+		{
+			if(!++(*ms))
+				(*epoch)++;
+			ticks = TCNT0;
+		}
+	}
+	return ticks;
+}
+
+/* Initialize the Timer 0 Timebase */
+void init_millis()
+{
+	// Stop Timer 0 while it is configured
+	// (TCCR0B): TC0 Control Register B
+	TCCR0B = 0;
+
+	// CTC - TOP: OCR0A
+	// (TCCR0A): TC0 Control Register A
+	// (WGM01): Waveform Generation Mode
+	TCCR0A = (1 << WGM01);
+	
+	// (OCR0A): TC0 Output Compare Register A, one match per millisecond
+	// (OCR0B): Matches at BOTTOM, so OCIE0B gives other modules a 1 ms tick
+	TCNT0 = 0;
+	OCR0A = (uint8_t) (MILLIS_TICKS_PER_MS - 1);
+	OCR0B = 0;
+	
+	g_millis = 0;
+	g_millis_epoch = 0;
+
+	// Clear a stale Compare Match Flag (Writing a logic one to the flag clears it)
+	TIFR0 = (1 << OCF0A);
+
+	// (TIMSK0): Timer/Counter 0 Interrupt Mask Register
+	// (OCIE0A): Output Compare A Match Interrupt Enable
+	TIMSK0 |= (1 << OCIE0A);
+
+	// Start the Timer: clk/64
+	// (CS0n): Clock Select 0 [n = 0:2]
+	TCCR0B = (1 << CS01) | (1 << CS00);
+
+	critical_sei();
+}
+
+/* Milliseconds since init_millis(), wraps every ~49.7 days */
+uint32_t millis()
+{
+	uint32_t ms;
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		ms = g_millis;
+	}
+	return ms;
+}
+
+/* Microseconds since init_millis(), wraps every ~71.6 minutes */
+uint32_t micros()
+{
+	uint16_t epoch;
+	uint32_t ms;
+	uint8_t ticks = read_timebase(&epoch, &ms);
+	return ms * 1000UL + (uint16_t) ticks * MILLIS_US_PER_TICK;
+}
+
+/* Microseconds since init_millis(), extended to 64 bits */
+uint64_t micros64()
+{
+	uint16_t epoch;
+	uint32_t ms;
+	uint8_t ticks = read_timebase(&epoch, &ms);
+	return ((((uint64_t) epoch << 32) | ms) * 1000ULL) + (uint16_t) ticks * MILLIS_US_PER_TICK;
+}
+
+/* Timebase Interrupt, kept to a 32-bit increment */
+ISR(TIMER0_COMPA_vect)
+{
+	uint32_t ms = g_millis + 1; // Local copy, the ISR cannot be interrupted
+	g_millis = ms;
+	if(!ms)
+		g_millis_epoch++;
+}
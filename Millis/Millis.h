@@ -0,0 +1,60 @@
+/*
+ * millis.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _MILLIS_H_
+#define _MILLIS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Millis Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 0 runs in CTC mode at clk/64 and matches once per millisecond.
+// The Timer 0 Compare A vector is owned by this module, leave
+// TIMER0_COMPA_DISPATCH compiled out. OCR0B matches at BOTTOM, so with
+// TIMER0_COMPB_DISPATCH=1 timer_attach(TIMER0_COMPB, ...) gives a 1 ms tick.
+#if TIMER0_COMPA_DISPATCH
+#error "Millis: TIMER0_COMPA is taken by this module, set TIMER0_COMPA_DISPATCH to 0"
+#endif
+
+#define MILLIS_PRESCALER 64
+#define MILLIS_TICKS_PER_MS ((F_CPU) / (MILLIS_PRESCALER) / 1000UL)
+#define MILLIS_US_PER_TICK (1000UL / (MILLIS_TICKS_PER_MS))
+
+#if ((F_CPU) % ((MILLIS_PRESCALER) * 1000UL)) != 0 || (MILLIS_TICKS_PER_MS) > 256 || (1000UL % (MILLIS_TICKS_PER_MS)) != 0
+#error "Millis: F_CPU must give a whole number of microseconds per Timer 0 tick"
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Millis Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_millis();
+uint32_t millis();
+uint32_t micros();
+uint64_t micros64();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _MILLIS_H_ */
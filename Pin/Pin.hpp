@@ -0,0 +1,138 @@
+/*
+ * pin.hpp
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _PIN_HPP_
+#define _PIN_HPP_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Pin Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Header-only C++ (-std=gnu++11) GPIO pin. Port and bit are template
+ * arguments, so every call folds to a single SBI/CBI/SBIC/OUT on the
+ * port registers with no runtime port lookup:
+ *	typedef Pin<PIN_PORT_B, 5> Led;
+ *	Led::output();
+ *	Led::toggle();
+ */
+#define PIN_PORT_B 0
+#define PIN_PORT_C 1
+#define PIN_PORT_D 2
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Pin Class
+ * //////////////////////////////////////////////////////////////////////////
+ */
+template<uint8_t Port, uint8_t N>
+class Pin
+{
+	static_assert(Port <= PIN_PORT_D, "Pin: port must be PIN_PORT_B, PIN_PORT_C or PIN_PORT_D");
+	static_assert(N < 8 && (Port != PIN_PORT_C || N < 7), "Pin: bit out of range for the port");
+
+	// (PINx), (DDRx), (PORTx): Port is a constant, each chain folds to one access
+	static uint8_t pin_read()
+	{
+		if(Port == PIN_PORT_B)
+			return PINB;
+		else if(Port == PIN_PORT_C)
+			return PINC;
+		else
+			return PIND;
+	}
+
+	static void pin_write(uint8_t value)
+	{
+		if(Port == PIN_PORT_B)
+			PINB = value;
+		else if(Port == PIN_PORT_C)
+			PINC = value;
+		else
+			PIND = value;
+	}
+
+	static void ddr_set(bool set)
+	{
+		if(Port == PIN_PORT_B)
+			DDRB = set ? (DDRB | mask) : (DDRB & (uint8_t) ~mask);
+		else if(Port == PIN_PORT_C)
+			DDRC = set ? (DDRC | mask) : (DDRC & (uint8_t) ~mask);
+		else
+			DDRD = set ? (DDRD | mask) : (DDRD & (uint8_t) ~mask);
+	}
+
+	static void port_set(bool set)
+	{
+		if(Port == PIN_PORT_B)
+			PORTB = set ? (PORTB | mask) : (PORTB & (uint8_t) ~mask);
+		else if(Port == PIN_PORT_C)
+			PORTC = set ? (PORTC | mask) : (PORTC & (uint8_t) ~mask);
+		else
+			PORTD = set ? (PORTD | mask) : (PORTD & (uint8_t) ~mask);
+	}
+
+public:
+	static constexpr uint8_t mask = (uint8_t) (1 << N);
+
+	/* Push-pull Output */
+	static void output()
+	{
+		ddr_set(true);
+	}
+
+	/* Floating Input (Pull-up off) */
+	static void input()
+	{
+		ddr_set(false);
+		port_set(false);
+	}
+
+	/* Input with Pull-up */
+	static void pullup()
+	{
+		ddr_set(false);
+		port_set(true);
+	}
+
+	static void high()
+	{
+		port_set(true);
+	}
+
+	static void low()
+	{
+		port_set(false);
+	}
+
+	static void write(bool level)
+	{
+		if(level)
+			high();
+		else
+			low();
+	}
+
+	/* Writing a logic one to PINxn toggles PORTxn */
+	static void toggle()
+	{
+		pin_write(mask);
+	}
+
+	static bool read()
+	{
+		return (pin_read() & mask) != 0;
+	}
+};
+
+#endif /* _PIN_HPP_ */
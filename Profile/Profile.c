@@ -0,0 +1,186 @@
+/*
+ * profile.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Profile.h"
+
+#if PROFILE_ENABLE
+
+#include <avr/interrupt.h>
+#include "Critical.h"
+#include "TIMER.h"
+#include "USART.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Profile Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+static volatile uint16_t g_profile_overflows; // Upper 16 bits of the cycle counter
+static uint16_t g_profile_overhead;			  // Cycles of an empty section
+static uint32_t g_profile_start[PROFILE_SECTIONS];
+static profile_section_t g_profile_sections[PROFILE_SECTIONS];
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Profile Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Initialize Timer 1 as a free-running 32-bit Cycle Counter */
+void init_profile()
+{
+	stop_timer1();
+	g_profile_overflows = 0;
+	
+	// Normal Mode
+	// (TCCR1A): TC1 Control Register A
+	TCCR1A = 0;
+	CRITICAL_BLOCK()
+	{
+		TCNT1 = 0;
+	}
+
+	// (TIMSK1): Overflow Interrupt
+	TIFR1 = (1 << TOV1);
+	TIMSK1 |= (1 << TOIE1);
+
+	// (TCCR1B): TC1 Control Register B, clk/1
+	TCCR1B = (TIMER1_PRESCALER_1 << CS10);
+	critical_sei();
+
+	// Calibration, the cost of one counter read is removed from every section.
+	// It starts from cleared statistics and no overhead, also on a re-init
+	g_profile_overhead = 0;
+	profile_reset();
+	profile_begin(0);
+	profile_end(0);
+	g_profile_overhead = (uint16_t) g_profile_sections[0].min;
+	profile_reset();
+}
+
+/* Current Cycle Count, wraps every 2^32 cycles */
+uint32_t profile_cycles()
+{
+	uint16_t low, high;
+	
+	CRITICAL_BLOCK()
+	{
+		low = TCNT1;
+		high = g_profile_overflows;
+
+		// Overflow not serviced yet, the low word has already wrapped
+		if((TIFR1 & (1 << TOV1)) && low < 0x8000)
+			high++;
+	}
+	return ((uint32_t) high << 16) | low;
+}
+
+/* Start a Section */
+void profile_begin(uint8_t id)
+{
+	if(id < PROFILE_SECTIONS)
+		g_profile_start[id] = profile_cycles();
+}
+
+/* End a Section and Accumulate its Cycles */
+void profile_end(uint8_t id)
+{
+	uint32_t cycles = profile_cycles();
+	
+	if(id >= PROFILE_SECTIONS)
+		return;
+	
+	cycles -= g_profile_start[id];
+	cycles = (cycles > g_profile_overhead) ? cycles - g_profile_overhead : 0;
+
+	profile_section_t *section = &g_profile_sections[id];
+	section->count++;
+	section->total += cycles;
+	if(cycles < section->min)
+		section->min = cycles;
+	if(cycles > section->max)
+		section->max = cycles;
+
+	// Bucket: Position of the highest set bit
+	uint8_t bucket = 0;
+	while((cycles >>= 1) && bucket < PROFILE_BUCKETS - 1)
+		bucket++;
+	if(section->histogram[bucket] != 0xFFFF)
+		section->histogram[bucket]++;
+}
+
+/* Clear all Statistics */
+void profile_reset()
+{
+	for(uint8_t id = 0; id < PROFILE_SECTIONS; id++)
+	{
+		profile_section_t *section = &g_profile_sections[id];
+		section->count = 0;
+		section->min = 0xFFFFFFFF;
+		section->max = 0;
+		section->total = 0;
+		for(uint8_t i = 0; i < PROFILE_BUCKETS; i++)
+			section->histogram[i] = 0;
+	}
+}
+
+/* Statistics of a Section */
+const profile_section_t *profile_section(uint8_t id)
+{
+	return (id < PROFILE_SECTIONS) ? &g_profile_sections[id] : 0;
+}
+
+/* Print an Unsigned 32-bit Value */
+static void profile_print(uint32_t value)
+{
+	char buffer[11];
+	put_string(ultoa(value, buffer, 10));
+}
+
+/* 
+ * Dump every used Section over the USART
+ * <id> count <n> min <c> max <c> avg <c>
+ * followed by the non-empty buckets as <2^n>:<hits>
+ */
+void profile_dump()
+{
+	for(uint8_t id = 0; id < PROFILE_SECTIONS; id++)
+	{
+		const profile_section_t *section = &g_profile_sections[id];
+		if(section->count == 0)
+			continue;
+
+		print_byte(id);
+		put_string(" count ");
+		profile_print(section->count);
+		put_string(" min ");
+		profile_print(section->min);
+		put_string(" max ");
+		profile_print(section->max);
+		put_string(" avg ");
+		profile_print((uint32_t) (section->total / section->count));
+		print_line();
+
+		for(uint8_t i = 0; i < PROFILE_BUCKETS; i++)
+		{
+			if(section->histogram[i] == 0)
+				continue;
+			put_string(" ");
+			profile_print(1UL << i);
+			put_string(":");
+			print_number(section->histogram[i]);
+		}
+		print_line();
+	}
+}
+
+/* Cycle Counter Upper Word */
+ISR(TIMER1_OVF_vect)
+{
+	g_profile_overflows++;
+}
+
+#endif
@@ -0,0 +1,96 @@
+/*
+ * profile.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Profile Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Set PROFILE_ENABLE to 1 project-wide to build the profiler. Left at 0 the
+// macros expand to nothing and Profile.c compiles to an empty unit.
+// Timer/Counter 1 runs at clk/1 as the cycle counter and its overflow
+// vector is owned by this module, leave TIMER1_OVF_DISPATCH compiled out.
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE 0
+#endif
+
+#if PROFILE_ENABLE && TIMER1_OVF_DISPATCH
+#error "Profile: TIMER1_OVF is taken by this module, set TIMER1_OVF_DISPATCH to 0"
+#endif
+
+#ifndef PROFILE_SECTIONS
+#define PROFILE_SECTIONS 8
+#endif
+
+// Bucket n counts sections that took [2^n, 2^(n + 1)) cycles, the last
+// bucket also holds everything longer
+#ifndef PROFILE_BUCKETS
+#define PROFILE_BUCKETS 20
+#endif
+
+#if PROFILE_ENABLE
+
+#define PROFILE_INIT() init_profile()
+#define PROFILE_BEGIN(id) profile_begin(id)
+#define PROFILE_END(id) profile_end(id)
+#define PROFILE_RESET() profile_reset()
+#define PROFILE_DUMP() profile_dump()
+
+#else
+
+#define PROFILE_INIT() ((void) 0)
+#define PROFILE_BEGIN(id) ((void) 0)
+#define PROFILE_END(id) ((void) 0)
+#define PROFILE_RESET() ((void) 0)
+#define PROFILE_DUMP() ((void) 0)
+
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Profile Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#if PROFILE_ENABLE
+
+typedef struct
+{
+	uint32_t count;
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+	uint16_t histogram[PROFILE_BUCKETS];
+} profile_section_t;
+
+void init_profile();
+uint32_t profile_cycles();
+void profile_begin(uint8_t id);
+void profile_end(uint8_t id);
+void profile_reset();
+const profile_section_t *profile_section(uint8_t id);
+void profile_dump();
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _PROFILE_H_ */
@@ -0,0 +1,158 @@
+/*
+ * scheduler.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Scheduler.h"
+
+#if TIMER2_COMPA_DISPATCH != TIMER_DISPATCH_DIRECT
+#error "Scheduler: build the project with TIMER2_COMPA_DISPATCH=1 for the scheduler tick"
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Scheduler Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+static void (*g_sched_tasks[SCHED_MAX_TASKS])();	 // Task table, indexed by priority
+static volatile uint16_t g_sched_delay[SCHED_MAX_TASKS]; // Ticks left before a delayed post, '0': Idle
+static volatile uint8_t g_sched_ready;				 // Ready bitmap, bit n: Task n ready
+
+// Lowest set bit of a nibble, the highest ready priority
+static const uint8_t g_sched_first_bit[16] = { 0, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0 };
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Scheduler Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Scheduler Tick, runs in the Timer 2 Compare A Interrupt */
+static void sched_tick(void *ctx)
+{
+	uint8_t ready = g_sched_ready;
+	
+	for(uint8_t i = 0; i < SCHED_MAX_TASKS; i++)
+	{
+		uint16_t delay = g_sched_delay[i];
+		if(delay && !(g_sched_delay[i] = delay - 1))
+			ready |= (1 << i);
+	}
+	
+	g_sched_ready = ready;
+}
+
+/* Highest priority in a non-zero ready bitmap */
+static inline uint8_t sched_highest(uint8_t ready)
+{
+	if(ready & 0x0f)
+		return g_sched_first_bit[ready & 0x0f];
+	return 4 + g_sched_first_bit[ready >> 4];
+}
+
+/* Initialize the Scheduler and its Timer 2 Tick */
+void init_scheduler()
+{
+	g_sched_ready = 0;
+	
+	for(uint8_t i = 0; i < SCHED_MAX_TASKS; i++)
+	{
+		g_sched_tasks[i] = 0;
+		g_sched_delay[i] = 0;
+	}
+	
+	// Idle mode keeps the timers and the USART running
+	set_sleep_mode(SLEEP_MODE_IDLE);
+	
+	// 1 ms tick: CTC - TOP: OCR2A, sized at compile time
+	TIMER2_CTC_INIT(US, SCHED_TICK_MS * 1000UL);
+	timer_attach(TIMER2_COMPA, sched_tick, 0);
+	critical_sei();
+}
+
+/* Register a Task, one per Priority */
+void sched_add_task(uint8_t priority, void (*task)())
+{
+	if(priority >= SCHED_MAX_TASKS)
+		return;
+	
+	CRITICAL_BLOCK()
+	{
+		g_sched_tasks[priority] = task;
+	}
+}
+
+/* Mark a Task as Ready, safe to call from Interrupts */
+void sched_post(uint8_t priority)
+{
+	if(priority >= SCHED_MAX_TASKS)
+		return;
+	
+	CRITICAL_BLOCK()
+	{
+		g_sched_ready |= (1 << priority);
+	}
+}
+
+/* Mark a Task as Ready after a Number of Ticks, '0' posts it right away */
+void sched_post_delayed(uint8_t priority, uint16_t ticks)
+{
+	if(priority >= SCHED_MAX_TASKS)
+		return;
+	
+	if(!ticks)
+	{
+		sched_post(priority);
+		return;
+	}
+	
+	CRITICAL_BLOCK()
+	{
+		g_sched_delay[priority] = ticks;
+	}
+}
+
+/* Cancel a Pending or Delayed Post */
+void sched_cancel(uint8_t priority)
+{
+	if(priority >= SCHED_MAX_TASKS)
+		return;
+	
+	CRITICAL_BLOCK()
+	{
+		g_sched_delay[priority] = 0;
+		g_sched_ready &= ~(1 << priority);
+	}
+}
+
+/* 
+ * Run Ready Tasks to Completion, Highest Priority First
+ * Never returns. The CPU sleeps whenever no task is ready.
+ */
+void sched_run()
+{
+	while(1)
+	{
+		cli();
+		uint8_t ready = g_sched_ready;
+		
+		if(!ready)
+		{
+			// The instruction after sei() always executes before a pending
+			// interrupt, so a post arriving here still wakes the CPU
+			sleep_enable();
+			sei();
+			sleep_cpu();
+			sleep_disable();
+			continue;
+		}
+		
+		uint8_t priority = sched_highest(ready);
+		g_sched_ready = ready & ~(1 << priority);
+		sei();
+		
+		if(g_sched_tasks[priority])
+			g_sched_tasks[priority]();
+	}
+}
@@ -0,0 +1,63 @@
+/*
+ * scheduler.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "Critical.h"
+#include "TIMER.h"
+#include "TIMER_SOLVER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Scheduler Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// One task per priority, one bit per task in the ready bitmap
+// Priority 0 is the highest
+#define SCHED_MAX_TASKS 8
+
+// Scheduler tick, driven by the Timer/Counter 2 Compare A vector in CTC mode
+#define SCHED_TICK_MS 1
+
+#define SCHED_PRIORITY_0 0
+#define SCHED_PRIORITY_1 1
+#define SCHED_PRIORITY_2 2
+#define SCHED_PRIORITY_3 3
+#define SCHED_PRIORITY_4 4
+#define SCHED_PRIORITY_5 5
+#define SCHED_PRIORITY_6 6
+#define SCHED_PRIORITY_7 7
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Scheduler Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_scheduler();
+void sched_add_task(uint8_t priority, void (*task)());
+void sched_post(uint8_t priority);
+void sched_post_delayed(uint8_t priority, uint16_t ticks);
+void sched_cancel(uint8_t priority);
+void sched_run();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _SCHEDULER_H_ */
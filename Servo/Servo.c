@@ -0,0 +1,202 @@
+/*
+ * servo.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Servo.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Servo Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define SERVO_IDLE 0xFF // Between the last pulse and the end of the frame
+
+// One pulse sequence per compare unit
+typedef struct
+{
+	uint8_t channel;  // Channel in its pulse, SERVO_IDLE otherwise
+	uint8_t first;	  // First channel of the sequence, '0' or '1'
+	uint16_t elapsed; // Ticks used by the pulses of this frame
+} servo_sequence_t;
+
+static volatile uint8_t *g_servo_port[SERVO_MAX_CHANNELS];
+static uint8_t g_servo_mask[SERVO_MAX_CHANNELS];
+static volatile uint16_t g_servo_ticks[SERVO_MAX_CHANNELS]; // Pulse width in Timer 1 ticks
+static volatile uint16_t g_servo_enabled;					 // Bit n: Channel n pulses
+static volatile uint8_t g_servo_count;
+
+static servo_sequence_t g_servo_sequences[2];
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Servo Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Initialize the Servo Driver on Timer 1 */
+void init_servo()
+{
+	stop_timer1();
+	
+	g_servo_count = 0;
+	g_servo_enabled = 0;
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		g_servo_sequences[i].channel = SERVO_IDLE;
+		g_servo_sequences[i].first = i;
+		g_servo_sequences[i].elapsed = 0;
+	}
+
+	// Normal Mode, both compare units start a frame shortly after the timer
+	// (TCCR1A): TC1 Control Register A
+	TCCR1A = 0;
+	CRITICAL_BLOCK()
+	{
+		TCNT1 = 0;
+		OCR1A = 100;
+		OCR1B = 100;
+	}
+
+	// (TIMSK1): Output Compare A and B Match Interrupts
+	TIFR1 = (1 << OCF1A) | (1 << OCF1B);
+	TIMSK1 |= (1 << OCIE1A) | (1 << OCIE1B);
+
+	// (TCCR1B): TC1 Control Register B, clk/8
+	// (CS1n): Clock Select 1 [n = 0:2]
+	TCCR1B = (TIMER1_PRESCALER_8 << CS10);
+
+	critical_sei();
+}
+
+/* 
+ * Attach a Pin as a Servo Channel, centered and idle until written
+ * Returns the channel, or SERVO_NO_CHANNEL if all are in use
+ */
+uint8_t servo_attach(uint8_t port, uint8_t pin)
+{
+	if(g_servo_count >= SERVO_MAX_CHANNELS || port > SERVO_PORT_D || pin > 7)
+		return SERVO_NO_CHANNEL;
+
+	uint8_t channel = g_servo_count;
+	uint8_t mask = (1 << pin);
+	volatile uint8_t *ddr;
+
+	switch(port)
+	{
+		case SERVO_PORT_B:
+			g_servo_port[channel] = &PORTB;
+			ddr = &DDRB;
+			break;
+		case SERVO_PORT_C:
+			g_servo_port[channel] = &PORTC;
+			ddr = &DDRC;
+			break;
+		default:
+			g_servo_port[channel] = &PORTD;
+			ddr = &DDRD;
+			break;
+	}
+	g_servo_mask[channel] = mask;
+	g_servo_ticks[channel] = ((SERVO_MIN_US + SERVO_MAX_US) / 2) * SERVO_TICKS_PER_US;
+
+	CRITICAL_BLOCK()
+	{
+		// Pin as Output, Low
+		*g_servo_port[channel] &= ~mask;
+		*ddr |= mask;
+		
+		// The sequences only see the channel once it is complete
+		g_servo_count = channel + 1;
+	}
+	return channel;
+}
+
+/* Set a Pulse Width in Microseconds, takes effect at the next pulse */
+void servo_write_us(uint8_t channel, uint16_t us)
+{
+	if(channel >= g_servo_count)
+		return;
+	
+	if(us < SERVO_MIN_US)
+		us = SERVO_MIN_US;
+	if(us > SERVO_MAX_US)
+		us = SERVO_MAX_US;
+
+	uint16_t ticks = us * SERVO_TICKS_PER_US;
+	
+	// 16-bit values are read by the interrupts, write them atomically
+	CRITICAL_BLOCK()
+	{
+		g_servo_ticks[channel] = ticks;
+		g_servo_enabled |= (1 << channel);
+	}
+}
+
+/* Set a Position in Degrees, 0 - 180 */
+void servo_write(uint8_t channel, uint8_t angle)
+{
+	if(angle > 180)
+		angle = 180;
+	servo_write_us(channel, SERVO_MIN_US + (uint16_t) ((uint32_t) angle * (SERVO_MAX_US - SERVO_MIN_US) / 180));
+}
+
+/* Stop the Pulses of a Channel, the pin stays low */
+void servo_detach(uint8_t channel)
+{
+	if(channel >= g_servo_count)
+		return;
+	
+	CRITICAL_BLOCK()
+	{
+		g_servo_enabled &= ~(1 << channel);
+	}
+}
+
+/* 
+ * Ends the current pulse of a sequence and starts the next one
+ * Returns the ticks until its next compare match
+ */
+static inline uint16_t servo_next(servo_sequence_t *sequence)
+{
+	uint8_t channel = sequence->channel;
+	uint8_t count = g_servo_count;
+
+	if(channel < count)
+		*g_servo_port[channel] &= ~g_servo_mask[channel];
+
+	channel = (channel == SERVO_IDLE) ? sequence->first : channel + 2;
+
+	if(channel < count)
+	{
+		uint16_t ticks = g_servo_ticks[channel];
+		if(g_servo_enabled & (1 << channel))
+			*g_servo_port[channel] |= g_servo_mask[channel];
+
+		sequence->channel = channel;
+		sequence->elapsed += ticks;
+		return ticks;
+	}
+
+	// Rest of the frame
+	uint16_t rest = (uint16_t) (SERVO_FRAME_US * SERVO_TICKS_PER_US) - sequence->elapsed;
+	sequence->channel = SERVO_IDLE;
+	sequence->elapsed = 0;
+	return rest;
+}
+
+/* 
+ * Sequence Interrupts
+ * The next match is relative to the previous one, so ISR latency
+ * never accumulates and pulse widths stay exact
+ */
+ISR(TIMER1_COMPA_vect)
+{
+	OCR1A += servo_next(&g_servo_sequences[0]);
+}
+
+ISR(TIMER1_COMPB_vect)
+{
+	OCR1B += servo_next(&g_servo_sequences[1]);
+}
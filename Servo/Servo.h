@@ -0,0 +1,74 @@
+/*
+ * servo.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _SERVO_H_
+#define _SERVO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Servo Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 1 free-runs at clk/8. Compare A sequences the even channels
+// and Compare B the odd ones, so two pulses overlap and 12 servos of up to
+// 2 ms each fit in one 20 ms frame. Both vectors are owned by this module,
+// leave TIMER1_COMPA_DISPATCH and TIMER1_COMPB_DISPATCH compiled out.
+#if TIMER1_COMPA_DISPATCH || TIMER1_COMPB_DISPATCH
+#error "Servo: TIMER1_COMPA and TIMER1_COMPB are taken by this module, set TIMER1_COMPA_DISPATCH and TIMER1_COMPB_DISPATCH to 0"
+#endif
+
+#define SERVO_MAX_CHANNELS 12
+#define SERVO_FRAME_US 20000UL
+
+#ifndef SERVO_MIN_US
+#define SERVO_MIN_US 1000
+#endif
+#ifndef SERVO_MAX_US
+#define SERVO_MAX_US 2000
+#endif
+
+#define SERVO_TICKS_PER_US ((F_CPU) / 8000000UL)
+
+#if ((F_CPU) % 8000000UL) != 0 || (SERVO_FRAME_US * SERVO_TICKS_PER_US) > 0xFFFF
+#error "Servo: F_CPU must be 8 or 16 MHz"
+#endif
+
+#define SERVO_PORT_B 0
+#define SERVO_PORT_C 1
+#define SERVO_PORT_D 2
+
+#define SERVO_NO_CHANNEL 0xFF
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Servo Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_servo();
+uint8_t servo_attach(uint8_t port, uint8_t pin);
+void servo_write_us(uint8_t channel, uint16_t us);
+void servo_write(uint8_t channel, uint8_t angle);
+void servo_detach(uint8_t channel);
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _SERVO_H_ */
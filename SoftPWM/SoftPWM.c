@@ -0,0 +1,229 @@
+/*
+ * softpwm.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "SoftPWM.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							SoftPWM Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Keeps the compiler from moving back buffer stores across g_softpwm_pending
+#define SOFTPWM_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
+// Pins cleared when the counter reaches time
+typedef struct
+{
+	uint16_t time;
+	uint8_t clear[3]; // PORTB, PORTC, PORTD
+} softpwm_edge_t;
+
+// One frame: pins set at the start and the sorted edges that clear them
+typedef struct
+{
+	uint8_t set[3];
+	uint8_t count;
+	softpwm_edge_t edges[SOFTPWM_MAX_CHANNELS];
+} softpwm_frame_t;
+
+static uint8_t g_softpwm_port[SOFTPWM_MAX_CHANNELS];
+static uint8_t g_softpwm_mask[SOFTPWM_MAX_CHANNELS];
+static uint8_t g_softpwm_duty[SOFTPWM_MAX_CHANNELS];
+static uint8_t g_softpwm_channels;
+static uint8_t g_softpwm_all[3]; // Every channel pin per port
+
+// Double buffered frames, the interrupts only read g_softpwm_frames[g_softpwm_active]
+static softpwm_frame_t g_softpwm_frames[2];
+static volatile uint8_t g_softpwm_active;
+static volatile uint8_t g_softpwm_pending; // Back buffer ready, swapped at the next frame
+static uint8_t g_softpwm_edge;			   // Next edge of the active frame
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							SoftPWM Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Initialize the SoftPWM Engine on Timer 1, all channels off */
+void init_softpwm()
+{
+	stop_timer1();
+	
+	g_softpwm_channels = 0;
+	g_softpwm_active = 0;
+	g_softpwm_pending = 0;
+	g_softpwm_edge = 0;
+	for(uint8_t i = 0; i < 3; i++)
+	{
+		g_softpwm_all[i] = 0;
+		g_softpwm_frames[0].set[i] = 0;
+		g_softpwm_frames[1].set[i] = 0;
+	}
+	g_softpwm_frames[0].count = 0;
+	g_softpwm_frames[1].count = 0;
+	
+	// CTC - TOP: OCR1A, one frame per period
+	// (TCCR1A): TC1 Control Register A
+	// (TCCR1B): TC1 Control Register B
+	TCCR1A = 0;
+	CRITICAL_BLOCK()
+	{
+		TCNT1 = 0;
+		OCR1A = (uint16_t) (SOFTPWM_FRAME_TICKS - 1);
+		OCR1B = 0xFFFF; // Past TOP, no edges yet
+	}
+
+	// (TIMSK1): Output Compare A and B Match Interrupts
+	TIFR1 = (1 << OCF1A) | (1 << OCF1B);
+	TIMSK1 |= (1 << OCIE1A) | (1 << OCIE1B);
+
+	// (CS1n): Clock Select 1 [n = 0:2]
+	TCCR1B = (1 << WGM12) | (SOFTPWM_PRESCALER << CS10);
+
+	critical_sei();
+}
+
+/* 
+ * Add a Pin as a Channel, driven low until its duty cycle is set
+ * Returns the channel, or SOFTPWM_NO_CHANNEL if the table is full
+ */
+uint8_t softpwm_add_channel(uint8_t port, uint8_t pin)
+{
+	if(g_softpwm_channels >= SOFTPWM_MAX_CHANNELS || port > SOFTPWM_PORT_D || pin > 7)
+		return SOFTPWM_NO_CHANNEL;
+
+	uint8_t channel = g_softpwm_channels++;
+	uint8_t mask = (1 << pin);
+	g_softpwm_port[channel] = port;
+	g_softpwm_mask[channel] = mask;
+	g_softpwm_duty[channel] = 0;
+
+	CRITICAL_BLOCK()
+	{
+		g_softpwm_all[port] |= mask;
+		
+		// Pin as Output, Low
+		switch(port)
+		{
+			case SOFTPWM_PORT_B:
+				PORTB &= ~mask;
+				DDRB |= mask;
+				break;
+			case SOFTPWM_PORT_C:
+				PORTC &= ~mask;
+				DDRC |= mask;
+				break;
+			default:
+				PORTD &= ~mask;
+				DDRD |= mask;
+				break;
+		}
+	}
+	return channel;
+}
+
+/* Set a Channel Duty Cycle, applied by softpwm_update() */
+void softpwm_set_duty(uint8_t channel, uint8_t duty)
+{
+	if(channel < g_softpwm_channels)
+		g_softpwm_duty[channel] = duty;
+}
+
+/* 
+ * Build the Edge Table from the Duty Cycles into the Back Buffer
+ * It is swapped in atomically at the start of the next frame
+ */
+void softpwm_update()
+{
+	// Withdraw a buffer the frame interrupt has not taken yet,
+	// so it is never swapped in while being rebuilt
+	g_softpwm_pending = 0;
+	SOFTPWM_BARRIER();
+	
+	softpwm_frame_t *frame = &g_softpwm_frames[g_softpwm_active ^ 1];
+	frame->set[0] = frame->set[1] = frame->set[2] = 0;
+	frame->count = 0;
+
+	for(uint8_t channel = 0; channel < g_softpwm_channels; channel++)
+	{
+		uint8_t duty = g_softpwm_duty[channel];
+		uint8_t port = g_softpwm_port[channel];
+		uint8_t mask = g_softpwm_mask[channel];
+
+		if(duty == SOFTPWM_DUTY_OFF)
+			continue;
+		
+		frame->set[port] |= mask;
+		if(duty == SOFTPWM_DUTY_FULL)
+			continue;
+		
+		// Insert into the sorted edges, channels with the same duty share an edge
+		uint16_t time = (uint16_t) duty * SOFTPWM_STEP_TICKS;
+		uint8_t i = 0;
+		while(i < frame->count && frame->edges[i].time < time)
+			i++;
+
+		if(i == frame->count || frame->edges[i].time != time)
+		{
+			for(uint8_t j = frame->count; j > i; j--)
+				frame->edges[j] = frame->edges[j - 1];
+			frame->edges[i].time = time;
+			frame->edges[i].clear[0] = frame->edges[i].clear[1] = frame->edges[i].clear[2] = 0;
+			frame->count++;
+		}
+		frame->edges[i].clear[port] |= mask;
+	}
+
+	// Publish the table only once it is complete
+	SOFTPWM_BARRIER();
+	g_softpwm_pending = 1;
+}
+
+/* 
+ * Clear the Channels of every Edge from edge on that the counter has reached
+ * or is about to reach, then aim Compare B at the first one still ahead.
+ * Edges too close to the counter would be missed by a compare match, and an
+ * interrupt delayed past its edge has to catch up, or the pins stay on
+ */
+static inline void softpwm_edges(const softpwm_frame_t *frame, uint8_t edge)
+{
+	while(edge < frame->count && frame->edges[edge].time <= TCNT1 + SOFTPWM_MIN_LEAD)
+	{
+		PORTB &= ~frame->edges[edge].clear[0];
+		PORTC &= ~frame->edges[edge].clear[1];
+		PORTD &= ~frame->edges[edge].clear[2];
+		edge++;
+	}
+
+	g_softpwm_edge = edge;
+	OCR1B = (edge < frame->count) ? frame->edges[edge].time : 0xFFFF;
+}
+
+/* Frame Interrupt, swaps in a pending table and sets the active channels */
+ISR(TIMER1_COMPA_vect)
+{
+	uint8_t active = g_softpwm_active;
+	if(g_softpwm_pending)
+	{
+		active ^= 1;
+		g_softpwm_active = active;
+		g_softpwm_pending = 0;
+	}
+
+	const softpwm_frame_t *frame = &g_softpwm_frames[active];
+	PORTB = (PORTB & ~g_softpwm_all[0]) | frame->set[0];
+	PORTC = (PORTC & ~g_softpwm_all[1]) | frame->set[1];
+	PORTD = (PORTD & ~g_softpwm_all[2]) | frame->set[2];
+
+	// Run behind another interrupt, the first edges may already be due
+	softpwm_edges(frame, 0);
+}
+
+/* Edge Interrupt, clears the channels whose duty cycle ended */
+ISR(TIMER1_COMPB_vect)
+{
+	softpwm_edges(&g_softpwm_frames[g_softpwm_active], g_softpwm_edge);
+}
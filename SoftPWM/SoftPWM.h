@@ -0,0 +1,73 @@
+/*
+ * softpwm.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _SOFTPWM_H_
+#define _SOFTPWM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							SoftPWM Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 1 runs in CTC mode: Compare A starts every frame and
+// Compare B walks a sorted table of edges, one interrupt per distinct duty.
+// Both vectors are owned by this module, leave TIMER1_COMPA_DISPATCH and
+// TIMER1_COMPB_DISPATCH compiled out.
+#if TIMER1_COMPA_DISPATCH || TIMER1_COMPB_DISPATCH
+#error "SoftPWM: TIMER1_COMPA and TIMER1_COMPB are taken by this module, set TIMER1_COMPA_DISPATCH and TIMER1_COMPB_DISPATCH to 0"
+#endif
+
+#ifndef SOFTPWM_MAX_CHANNELS
+#define SOFTPWM_MAX_CHANNELS 16
+#endif
+
+// 256 steps per frame at clk/8: 16 MHz / 8 / (256 * 32) = 244 Hz
+#define SOFTPWM_PRESCALER TIMER1_PRESCALER_8
+#define SOFTPWM_STEP_TICKS 32
+#define SOFTPWM_FRAME_TICKS (256UL * SOFTPWM_STEP_TICKS)
+
+// Edges closer than this to the counter are handled in the same interrupt
+#define SOFTPWM_MIN_LEAD 12
+
+#define SOFTPWM_PORT_B 0
+#define SOFTPWM_PORT_C 1
+#define SOFTPWM_PORT_D 2
+
+#define SOFTPWM_NO_CHANNEL 0xFF
+
+// Duty cycle, 0: Off, 255: Always on
+#define SOFTPWM_DUTY_OFF 0
+#define SOFTPWM_DUTY_FULL 255
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							SoftPWM Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_softpwm();
+uint8_t softpwm_add_channel(uint8_t port, uint8_t pin);
+void softpwm_set_duty(uint8_t channel, uint8_t duty);
+void softpwm_update();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _SOFTPWM_H_ */
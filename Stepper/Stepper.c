@@ -0,0 +1,381 @@
+/*
+ * stepper.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Stepper.h"
+#include <math.h>
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Stepper Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define STEPPER_PULSE_TICKS ((STEPPER_TIMER_HZ / 1000000UL) * STEPPER_PULSE_US)
+
+// Keeps the compiler from moving slot stores across the head update
+#define STEPPER_BARRIER() __asm__ __volatile__ ("" ::: "memory")
+
+// A queued move, everything needing a division is solved when it is queued.
+// Intervals are 16.16 fixed point timer ticks.
+typedef struct
+{
+	uint32_t delta[STEPPER_MAX_AXES]; // Steps per axis
+	uint32_t steps;					  // Steps of the leading axis
+	uint32_t accel_end;				  // Last step of the acceleration ramp
+	uint32_t decel_start;			  // First step of the deceleration ramp
+	uint8_t direction;				  // Bit n: Axis n runs backwards
+	uint32_t p0;					  // First interval
+	uint32_t p_min;					  // Cruise interval
+	uint16_t k;						  // Ramp constant m = acceleration / F^2,
+	uint8_t shift;					  // as k / 2^(32 + shift)
+} stepper_move_t;
+
+typedef struct
+{
+	volatile uint8_t *step_port;
+	volatile uint8_t *dir_port;
+	uint8_t step_mask;
+	uint8_t dir_mask;
+} stepper_axis_t;
+
+static stepper_axis_t g_stepper_axes[STEPPER_MAX_AXES];
+static volatile int32_t g_stepper_position[STEPPER_MAX_AXES];
+
+static stepper_move_t g_stepper_queue[STEPPER_QUEUE_SIZE];
+static volatile uint8_t g_stepper_head; // Written by stepper_move
+static volatile uint8_t g_stepper_tail; // Written by the interrupt
+
+// Interrupt state of the running move
+static uint8_t g_stepper_running;
+static uint32_t g_stepper_step;
+static uint32_t g_stepper_error[STEPPER_MAX_AXES];
+static uint32_t g_stepper_interval; // Interval of the step ahead, 16.16
+static uint16_t g_stepper_fraction; // Tick fractions carried between steps
+static uint16_t g_stepper_ticks;	// Next match distance, solved one step early
+static uint8_t g_stepper_pulse;		// Axes whose step pin is high
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Stepper Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* Initialize the Motion Engine on Timer 1, idle until a move is queued */
+void init_stepper()
+{
+	stop_timer1();
+	
+	g_stepper_head = 0;
+	g_stepper_tail = 0;
+	g_stepper_running = 0;
+
+	// Normal Mode, each match is scheduled relative to the previous one
+	// (TCCR1A): TC1 Control Register A
+	// (TCCR1B): TC1 Control Register B, clk/8
+	TCCR1A = 0;
+	CRITICAL_BLOCK()
+	{
+		TCNT1 = 0;
+		OCR1A = STEPPER_MIN_INTERVAL;
+	}
+	TIMSK1 &= ~((1 << OCIE1A) | (1 << OCIE1B));
+	TCCR1B = (TIMER1_PRESCALER_8 << CS10);
+
+	critical_sei();
+}
+
+/* Set the Step and Direction Pins of an Axis */
+void stepper_axis(uint8_t axis, uint8_t port, uint8_t step_pin, uint8_t dir_pin)
+{
+	if(axis >= STEPPER_MAX_AXES)
+		return;
+
+	stepper_axis_t *a = &g_stepper_axes[axis];
+	volatile uint8_t *ddr;
+
+	switch(port)
+	{
+		case STEPPER_PORT_B:
+			a->step_port = &PORTB;
+			ddr = &DDRB;
+			break;
+		case STEPPER_PORT_C:
+			a->step_port = &PORTC;
+			ddr = &DDRC;
+			break;
+		default:
+			a->step_port = &PORTD;
+			ddr = &DDRD;
+			break;
+	}
+	a->dir_port = a->step_port;
+	a->step_mask = (1 << step_pin);
+	a->dir_mask = (1 << dir_pin);
+
+	CRITICAL_BLOCK()
+	{
+		*a->step_port &= ~(a->step_mask | a->dir_mask);
+		*ddr |= a->step_mask | a->dir_mask;
+	}
+}
+
+/* 
+ * Queue a Coordinated Move
+ * steps: Signed steps per axis, speed: Steps/s and acceleration: Steps/s^2
+ * of the leading axis, the other axes follow it in proportion.
+ * Returns '1' if queued, '0' if the queue is full
+ */
+uint8_t stepper_move(const int32_t steps[STEPPER_MAX_AXES], uint16_t speed, uint16_t acceleration)
+{
+	uint8_t head = g_stepper_head;
+	uint8_t next = (head + 1) & (STEPPER_QUEUE_SIZE - 1);
+
+	if(next == g_stepper_tail)
+		return 0;
+	if(speed == 0 || acceleration == 0)
+		return 0;
+
+	stepper_move_t *move = &g_stepper_queue[head];
+	move->steps = 0;
+	move->direction = 0;
+
+	for(uint8_t i = 0; i < STEPPER_MAX_AXES; i++)
+	{
+		// Axes without pins never step
+		if(g_stepper_axes[i].step_mask == 0)
+			move->delta[i] = 0;
+		else if(steps[i] < 0)
+		{
+			move->delta[i] = -steps[i];
+			move->direction |= (1 << i);
+		}
+		else
+			move->delta[i] = steps[i];
+
+		if(move->delta[i] > move->steps)
+			move->steps = move->delta[i];
+	}
+
+	if(move->steps == 0)
+		return 1;
+
+	// Steps to reach the cruise speed, v^2 / 2a, a triangle if the move is short
+	uint32_t ramp = ((uint32_t) speed * speed) / (2UL * acceleration);
+	if(ramp > move->steps / 2)
+		ramp = move->steps / 2;
+	move->accel_end = ramp;
+	move->decel_start = move->steps - ramp;
+
+	// First interval F * sqrt(2 / a) with the 0.676 first-step correction,
+	// every following one comes from p' = p * (1 -+ m * p^2)
+	const float f = (float) STEPPER_TIMER_HZ;
+	float p_min = f / speed;
+	float p0 = 0.676f * f * sqrtf(2.0f / acceleration);
+
+	if(p_min < STEPPER_MIN_INTERVAL)
+		p_min = STEPPER_MIN_INTERVAL;
+	if(p0 > 65535.0f)
+		p0 = 65535.0f;
+	if(p0 < p_min)
+		p0 = p_min;
+	move->p_min = (uint32_t) (p_min * 65536.0f);
+	move->p0 = (uint32_t) (p0 * 65536.0f);
+
+	// m * 2^32, scaled up to 15-16 significant bits for the interrupt
+	float k = (float) acceleration / (f * f) * 4294967296.0f;
+	uint8_t shift = 0;
+	while(k < 32768.0f && shift < 31)
+	{
+		k *= 2.0f;
+		shift++;
+	}
+	move->k = (k < 65535.0f) ? (uint16_t) (k + 0.5f) : 0xFFFF;
+	move->shift = shift;
+
+	// Publish the slot only once it is complete
+	STEPPER_BARRIER();
+	g_stepper_head = next;
+
+	// Wake the engine, its first interrupt loads the move
+	CRITICAL_BLOCK()
+	{
+		if(!(TIMSK1 & (1 << OCIE1A)))
+		{
+			OCR1A = TCNT1 + STEPPER_MIN_INTERVAL;
+			TIFR1 = (1 << OCF1A);
+			TIMSK1 |= (1 << OCIE1A);
+		}
+	}
+	return 1;
+}
+
+/* Returns '1' while a move is running or queued */
+uint8_t stepper_busy()
+{
+	return (TIMSK1 & (1 << OCIE1A)) ? 1 : 0;
+}
+
+/* Free Slots in the Move Queue */
+uint8_t stepper_queue_free()
+{
+	return (STEPPER_QUEUE_SIZE - 1) - ((g_stepper_head - g_stepper_tail) & (STEPPER_QUEUE_SIZE - 1));
+}
+
+/* Current Position of an Axis in Steps */
+int32_t stepper_position(uint8_t axis)
+{
+	int32_t position;
+
+	if(axis >= STEPPER_MAX_AXES)
+		return 0;
+
+	CRITICAL_BLOCK()
+	{
+		position = g_stepper_position[axis];
+	}
+	return position;
+}
+
+/* Whole ticks of an interval, the fractions add up over the steps */
+static inline uint16_t stepper_ticks(uint32_t interval)
+{
+	uint32_t fraction = (uint32_t) g_stepper_fraction + (uint16_t) interval;
+
+	g_stepper_fraction = (uint16_t) fraction;
+	return (uint16_t) (interval >> 16) + (uint16_t) (fraction >> 16);
+}
+
+/* 
+ * Interval after a Step of the Move, from the previous one
+ * p' = p -+ m * p^3 with 16 x 16 bit products only: q = m * p^2 as a 0.24
+ * fraction, then p * q. p is rounded to whole ticks for the products,
+ * truncating would bias every ramp step the same way.
+ */
+static inline void stepper_advance(stepper_move_t *move, uint32_t step)
+{
+	uint32_t p = g_stepper_interval;
+
+	if(step <= move->accel_end || step > move->decel_start)
+	{
+		uint16_t pi = (uint16_t) ((p + 0x8000UL) >> 16);
+		uint32_t t = (uint32_t) pi * pi;
+
+		// u = p^2 * k / 2^16 = q * 2^(16 + shift)
+		uint32_t u = (t >> 16) * move->k + (((t & 0xFFFF) * move->k) >> 16);
+		uint32_t q = (move->shift >= 8) ? u >> (move->shift - 8) : u << (8 - move->shift);
+		if(q > 0xFFFFFFUL)
+			q = 0xFFFFFFUL;
+
+		// dp = p * q as 16.16
+		uint32_t dp = (uint32_t) pi * (uint16_t) (q >> 8) + (((uint32_t) pi * (uint8_t) q) >> 8);
+
+		if(step <= move->accel_end)
+			p = (p - move->p_min > dp) ? p - dp : move->p_min;
+		else
+			p = (move->p0 - p > dp) ? p + dp : move->p0;
+	}
+	else
+		p = move->p_min;
+
+	g_stepper_interval = p;
+	g_stepper_ticks = stepper_ticks(p);
+}
+
+/* Load the next Move, set the directions and schedule its first step */
+static inline void stepper_load()
+{
+	uint8_t tail = g_stepper_tail;
+
+	if(tail == g_stepper_head)
+	{
+		// Queue drained, sleep until the next move
+		TIMSK1 &= ~(1 << OCIE1A);
+		return;
+	}
+
+	stepper_move_t *move = &g_stepper_queue[tail];
+	for(uint8_t i = 0; i < STEPPER_MAX_AXES; i++)
+	{
+		stepper_axis_t *a = &g_stepper_axes[i];
+		if(a->step_mask == 0)
+			continue;
+		else if(move->direction & (1 << i))
+			*a->dir_port |= a->dir_mask;
+		else
+			*a->dir_port &= ~a->dir_mask;
+	}
+	for(uint8_t i = 0; i < STEPPER_MAX_AXES; i++)
+		g_stepper_error[i] = move->steps / 2;
+
+	// The direction pins settle for one interval before the first step
+	g_stepper_fraction = 0;
+	OCR1A += stepper_ticks(move->p0);
+
+	g_stepper_step = 0;
+	g_stepper_interval = move->p0;
+	g_stepper_running = 1;
+	stepper_advance(move, 1);
+}
+
+/* 
+ * Step Interrupt
+ * One step of the leading axis per match, the others by Bresenham. The
+ * next match is set first, from the interval solved one step earlier, so
+ * the work below never delays it. The next interval comes from the
+ * previous one without any division or float.
+ */
+ISR(TIMER1_COMPA_vect)
+{
+	if(!g_stepper_running)
+	{
+		stepper_load();
+		return;
+	}
+
+	OCR1A += g_stepper_ticks;
+
+	stepper_move_t *move = &g_stepper_queue[g_stepper_tail];
+	uint8_t stepped = 0;
+
+	for(uint8_t i = 0; i < STEPPER_MAX_AXES; i++)
+	{
+		g_stepper_error[i] += move->delta[i];
+		if(g_stepper_error[i] >= move->steps)
+		{
+			g_stepper_error[i] -= move->steps;
+			*g_stepper_axes[i].step_port |= g_stepper_axes[i].step_mask;
+			g_stepper_position[i] += (move->direction & (1 << i)) ? -1 : 1;
+			stepped |= (1 << i);
+		}
+	}
+
+	// Compare B ends the step pulse after its minimum width
+	OCR1B = TCNT1 + STEPPER_PULSE_TICKS;
+	TIFR1 = (1 << OCF1B);
+	TIMSK1 |= (1 << OCIE1B);
+	g_stepper_pulse = stepped;
+
+	uint32_t step = ++g_stepper_step;
+	if(step >= move->steps)
+	{
+		// Move done, the next one is loaded on the following match
+		g_stepper_running = 0;
+		g_stepper_tail = (g_stepper_tail + 1) & (STEPPER_QUEUE_SIZE - 1);
+	}
+	else
+		stepper_advance(move, step + 1);
+}
+
+/* Step Pulse End */
+ISR(TIMER1_COMPB_vect)
+{
+	TIMSK1 &= ~(1 << OCIE1B);
+
+	for(uint8_t i = 0; i < STEPPER_MAX_AXES; i++)
+	{
+		if(g_stepper_pulse & (1 << i))
+			*g_stepper_axes[i].step_port &= ~g_stepper_axes[i].step_mask;
+	}
+}
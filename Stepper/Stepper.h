@@ -0,0 +1,82 @@
+/*
+ * stepper.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _STEPPER_H_
+#define _STEPPER_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Stepper Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 1 in Normal Mode at clk/8, one Compare A interrupt per step
+// and a Compare B interrupt ending each step pulse. Both vectors are owned
+// by this module, leave TIMER1_COMPA/COMPB_DISPATCH compiled out.
+#if TIMER1_COMPA_DISPATCH || TIMER1_COMPB_DISPATCH
+#error "Stepper: TIMER1_COMPA and TIMER1_COMPB are taken by this module, set TIMER1_COMPA_DISPATCH and TIMER1_COMPB_DISPATCH to 0"
+#endif
+
+#ifndef STEPPER_MAX_AXES
+#define STEPPER_MAX_AXES 3
+#endif
+
+// Queued moves, power of two
+#ifndef STEPPER_QUEUE_SIZE
+#define STEPPER_QUEUE_SIZE 8
+#endif
+
+#define STEPPER_TIMER_HZ ((F_CPU) / 8UL)
+
+// Shortest step interval in timer ticks, bounds the step rate to what the
+// interrupt can compute (40 us, 25 kHz at 16 MHz)
+#ifndef STEPPER_MIN_INTERVAL
+#define STEPPER_MIN_INTERVAL (STEPPER_TIMER_HZ / 25000UL)
+#endif
+
+// Step pulse high time
+#ifndef STEPPER_PULSE_US
+#define STEPPER_PULSE_US 2
+#endif
+
+#define STEPPER_PORT_B 0
+#define STEPPER_PORT_C 1
+#define STEPPER_PORT_D 2
+
+#if (STEPPER_QUEUE_SIZE & (STEPPER_QUEUE_SIZE - 1)) != 0
+#error "Stepper: STEPPER_QUEUE_SIZE must be a power of two"
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Stepper Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_stepper();
+void stepper_axis(uint8_t axis, uint8_t port, uint8_t step_pin, uint8_t dir_pin);
+uint8_t stepper_move(const int32_t steps[STEPPER_MAX_AXES], uint16_t speed, uint16_t acceleration);
+uint8_t stepper_busy();
+uint8_t stepper_queue_free();
+int32_t stepper_position(uint8_t axis);
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _STEPPER_H_ */
@@ -0,0 +1,221 @@
+/*
+ * tickless.c
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#include "Tickless.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Tickless Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+static volatile uint32_t g_tickless_overflows; // Upper 24 bits of the timebase
+
+// Software timers, only touched from the main loop
+static struct
+{
+	uint32_t deadline;
+	uint32_t period; // '0': One-shot
+	void (*callback)(void *ctx);
+	void *ctx;
+} g_tickless_timers[TICKLESS_MAX_TIMERS];
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Tickless Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Wait for one TOSC1 cycle through a dummy write
+ * Needed after a wakeup before reading TCNT2 or sleeping again
+ */
+static inline void tickless_sync()
+{
+	// (ASSR): Asynchronous Status Register
+	// (OCR2BUB): Output Compare Register 2 B Update Busy
+	OCR2B = 0;
+	while(ASSR & (1 << OCR2BUB));
+}
+
+/* Initialize the Asynchronous Timer 2 Timebase */
+void init_tickless()
+{
+	// (TIMSK2): Disable the Timer 2 interrupts while switching clocks
+	TIMSK2 = 0;
+
+	// (AS2): Asynchronous Timer/Counter 2, clocked from the TOSC1 crystal
+	ASSR = (1 << AS2);
+
+	// Normal Mode
+	TCNT2 = 0;
+	OCR2A = 0;
+	OCR2B = 0;
+	TCCR2A = 0;
+	TCCR2B = (TICKLESS_PRESCALER << CS20);
+
+	// Writes reach the asynchronous domain after up to two TOSC cycles
+	while(ASSR & ((1 << TCN2UB) | (1 << OCR2AUB) | (1 << OCR2BUB) | (1 << TCR2AUB) | (1 << TCR2BUB)));
+
+	for(uint8_t i = 0; i < TICKLESS_MAX_TIMERS; i++)
+		g_tickless_timers[i].callback = 0;
+	g_tickless_overflows = 0;
+
+	// Clear flags raised while switching clocks, then enable the Overflow Interrupt
+	TIFR2 = (1 << OCF2B) | (1 << OCF2A) | (1 << TOV2);
+	TIMSK2 = (1 << TOIE2);
+
+	critical_sei();
+}
+
+/* Ticks since init_tickless(), wraps every ~48.5 days */
+uint32_t tickless_now()
+{
+	uint32_t overflows;
+	uint8_t ticks;
+	
+	CRITICAL_BLOCK()
+	{
+		overflows = g_tickless_overflows;
+		ticks = TCNT2;
+
+		// The counter wrapped but the Overflow Interrupt has not run yet
+		if((TIFR2 & (1 << TOV2)) && ticks < 128)
+			overflows++;
+	}
+	return (overflows << 8) | ticks;
+}
+
+/* 
+ * Start a Software Timer
+ * ticks: First expiry from now, period: Reload, '0' for one-shot
+ * The callback runs from tickless_idle(), in the main loop
+ */
+void tickless_timer_start(uint8_t id, uint32_t ticks, uint32_t period, void (*callback)(void *ctx), void *ctx)
+{
+	if(id >= TICKLESS_MAX_TIMERS)
+		return;
+	
+	g_tickless_timers[id].deadline = tickless_now() + ticks;
+	g_tickless_timers[id].period = period;
+	g_tickless_timers[id].ctx = ctx;
+	g_tickless_timers[id].callback = callback;
+}
+
+/* Stop a Software Timer */
+void tickless_timer_stop(uint8_t id)
+{
+	if(id < TICKLESS_MAX_TIMERS)
+		g_tickless_timers[id].callback = 0;
+}
+
+/* Run the Expired Timers, returns '1' if a timer is still pending */
+static uint8_t tickless_run_expired(uint32_t *next)
+{
+	uint8_t pending = 0;
+	uint32_t now = tickless_now();
+
+	for(uint8_t i = 0; i < TICKLESS_MAX_TIMERS; i++)
+	{
+		void (*callback)(void *ctx) = g_tickless_timers[i].callback;
+		if(!callback)
+			continue;
+
+		if((int32_t) (now - g_tickless_timers[i].deadline) >= 0)
+		{
+			if(g_tickless_timers[i].period)
+			{
+				g_tickless_timers[i].deadline += g_tickless_timers[i].period;
+				
+				// Late by more than a period, skip the missed expiries
+				if((int32_t) (now - g_tickless_timers[i].deadline) >= 0)
+					g_tickless_timers[i].deadline = now + g_tickless_timers[i].period;
+			}
+			else
+				g_tickless_timers[i].callback = 0;
+
+			callback(g_tickless_timers[i].ctx);
+		}
+
+		// The callback may have stopped or restarted the timer
+		if(g_tickless_timers[i].callback)
+		{
+			uint32_t deadline = g_tickless_timers[i].deadline;
+			if(!pending || (int32_t) (deadline - *next) < 0)
+				*next = deadline;
+			pending = 1;
+		}
+	}
+	return pending;
+}
+
+/* 
+ * Program the Wakeup for the Earliest Deadline
+ * Deadlines past the current overflow are reached through the Overflow Interrupt
+ */
+static void tickless_program(uint8_t pending, uint32_t next)
+{
+	uint32_t now = tickless_now();
+
+	if(pending)
+	{
+		if((int32_t) (next - now) < TICKLESS_MIN_LEAD)
+			next = now + TICKLESS_MIN_LEAD;
+		
+		if((next >> 8) == (now >> 8))
+		{
+			// (OCR2A): Output Compare Register 2 A
+			OCR2A = (uint8_t) next;
+			while(ASSR & (1 << OCR2AUB));
+			
+			// (OCIE2A): Output Compare A Match Interrupt Enable
+			TIFR2 = (1 << OCF2A);
+			TIMSK2 |= (1 << OCIE2A);
+			return;
+		}
+	}
+	TIMSK2 &= ~(1 << OCIE2A);
+}
+
+/* 
+ * Tickless Idle, call from the main loop when there is nothing to do
+ * Runs expired timers, programs the next wakeup and enters Power-save sleep
+ * until a timer or any other interrupt wakes the CPU
+ */
+void tickless_idle()
+{
+	uint32_t next;
+	uint8_t pending = tickless_run_expired(&next);
+	
+	tickless_program(pending, next);
+
+	// A wakeup in the last TOSC cycle would end the next sleep right away
+	tickless_sync();
+
+	// Power-save keeps the asynchronous Timer 2 running, the rest of the clocks stop
+	set_sleep_mode(SLEEP_MODE_PWR_SAVE);
+	cli();
+	sleep_enable();
+	sleep_bod_disable();
+	sei();
+	sleep_cpu();
+	sleep_disable();
+
+	// TCNT2 is only valid one TOSC cycle after the wakeup
+	tickless_sync();
+	tickless_run_expired(&next);
+}
+
+/* Overflow Interrupt, extends the timebase to 32 bits */
+ISR(TIMER2_OVF_vect)
+{
+	g_tickless_overflows++;
+}
+
+/* Compare A Interrupt, only wakes the CPU for the next deadline */
+ISR(TIMER2_COMPA_vect)
+{
+	TIMSK2 &= ~(1 << OCIE2A);
+}
@@ -0,0 +1,66 @@
+/*
+ * tickless.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _TICKLESS_H_
+#define _TICKLESS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include "Critical.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Tickless Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer/Counter 2 is clocked asynchronously from a 32.768 kHz crystal on
+// TOSC1/TOSC2 (PB6/PB7) and keeps counting in Power-save sleep. Its Compare A
+// and Overflow vectors are owned by this module, leave TIMER2_COMPA_DISPATCH
+// and TIMER2_OVF_DISPATCH compiled out (the Scheduler tick cannot be used).
+#if TIMER2_COMPA_DISPATCH || TIMER2_OVF_DISPATCH
+#error "Tickless: TIMER2_COMPA and TIMER2_OVF are taken by this module, set TIMER2_COMPA_DISPATCH and TIMER2_OVF_DISPATCH to 0"
+#endif
+
+#define TICKLESS_CRYSTAL_HZ 32768UL
+#define TICKLESS_PRESCALER TIMER2_PRESCALER_32
+#define TICKLESS_HZ (TICKLESS_CRYSTAL_HZ / 32) // 1024 ticks per second, overflow every 250 ms
+
+// Milliseconds to Ticks, rounded, resolved at compile time for constants
+#define TICKLESS_MS(ms) ((uint32_t) (((ms) * TICKLESS_HZ + 500UL) / 1000UL))
+
+// Software timers sharing the timebase
+#define TICKLESS_MAX_TIMERS 4
+
+// Shortest wakeup lead, the compare unit needs two TOSC cycles to update OCR2A
+#define TICKLESS_MIN_LEAD 3
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Tickless Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_tickless();
+uint32_t tickless_now();
+void tickless_timer_start(uint8_t id, uint32_t ticks, uint32_t period, void (*callback)(void *ctx), void *ctx);
+void tickless_timer_stop(uint8_t id);
+void tickless_idle();
+
+#ifdef __cplusplus
+}
+#endif 
+
+#endif /* _TICKLESS_H_ */
@@ -4,7 +4,39 @@
  * Created: 6/20/2019
  * Author: Miguel Osuna
  */ 
-#include "timer.h"
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter Vector Variables
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Callback and context attached to each vector
+static struct
+{
+	timer_callback_t callback;
+	void *ctx;
+} g_timer_vectors[TIMER_VECTOR_COUNT];
+
+// Vectors compiled into this file, timer_attach() refuses the others
+static const uint8_t g_timer_dispatch[TIMER_VECTOR_COUNT] =
+{
+	TIMER0_COMPA_DISPATCH, TIMER0_COMPB_DISPATCH, TIMER0_OVF_DISPATCH,
+	TIMER1_COMPA_DISPATCH, TIMER1_COMPB_DISPATCH, TIMER1_OVF_DISPATCH, TIMER1_CAPT_DISPATCH,
+	TIMER2_COMPA_DISPATCH, TIMER2_COMPB_DISPATCH, TIMER2_OVF_DISPATCH
+};
+
+// Callbacks given to init_timerN()
+static void (*gp_timer0_func)();
+static void (*gp_timer1_func)();
+static void (*gp_timer2_func)();
+
+/* Calls a Callback given to init_timerN(), ctx points to its Function Pointer */
+static void timer_legacy_callback(void *ctx)
+{
+	(*(void (**)()) ctx)();
+}
+
 /*
  * //////////////////////////////////////////////////////////////////////////
  *						Timer/Counter 1 Functions
@@ -110,16 +142,27 @@ static inline void set_timer1_ticks(uint16_t prescaler, uint16_t msec)
 			break;
 	}
 
-	uint16_t ticks; // Up to 65535
-	ticks = (uint16_t) (((F_CPU) / (prescaler) * (msec) / (1000)) - 1);
-	OCR1A |= ticks;
+	// Saturate instead of wrapping when the period does not fit the prescaler
+	// See TIMER_SOLVER.h to size the timer at compile time instead
+	// Ticks per millisecond first: 32 bits hold it for any msec (F_CPU < 65 MHz)
+	uint32_t ticks = (uint32_t) ((F_CPU) / 1000UL) * msec / prescaler;
+	if(ticks > 0x10000)
+		ticks = 0x10000;
+	if(!ticks)
+		ticks = 1;
+
+	// 16-bit registers share the TEMP register, write them atomically
+	CRITICAL_BLOCK()
+	{
+		OCR1A = (uint16_t) (ticks - 1);
+	}
 }
 
 /* 
  * Timer 1 Interrupt Enable
- * Sets the Interrupt corresponded to the Waveform Configuration 
+ * Attaches f to the Interrupt corresponded to the Waveform Configuration 
  */
-static inline void set_timer1_interrupt(uint8_t interrupt)
+static inline uint8_t set_timer1_interrupt(uint8_t interrupt, void (*f)())
 {
 	/* 
 	 * Waveform Mode 
@@ -127,33 +170,43 @@ static inline void set_timer1_interrupt(uint8_t interrupt)
 	 * '1': CTC (Clear Timer on Compare Match) -> TOP: OCR1A
 	 * '2': CTC (Clear Timer on Compare Match) -> TOP: ICR1 
 	 */ 	
+	uint8_t vector;
 	switch(interrupt)
 	{
-		// (TIMSK1): Timer/Counter 1 Interrupt Mask Register
-		// (TOIE1): Overflow Interrupt Enable 1
+		// (TOIE1): Overflow Interrupt
 		case WAVEFORM_NORMAL: 
-			TIMSK1 |= (1 << TOIE1);
+			vector = TIMER1_OVF;
 			break;
 			
-		// (OCIE1A): Output Compare A Match Interrupt Enable 1
+		// (OCIE1A): Output Compare A Match Interrupt
 		case WAVEFORM_CTC_OCR1A:
-			TIMSK1 |= (1 << OCIE1A);
+			vector = TIMER1_COMPA;
 			break;
 			
-		// (ICIE): Input Capture Interrupt Enable 1
+		// (ICIE1): Input Capture Interrupt
 		case WAVEFORM_CTC_ICR1:
-			TIMSK1 |= (1 << ICIE1);
+			vector = TIMER1_CAPT;
 			break;
 
 		default:
-			TIMSK1 |= (1 << TOIE1);
+			vector = TIMER1_OVF;
+			break;
 	}
 
-	sei();
+	// Refused if the vector is compiled out (TIMER1_xxx_DISPATCH)
+	gp_timer1_func = f;
+	if(!timer_attach(vector, timer_legacy_callback, &gp_timer1_func))
+		return 0;
+
+	critical_sei();
+	return 1;
 }
 
-/* Initialize Timer 1 */
-void init_timer1(uint8_t waveform_mode, uint16_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)())
+/* 
+ * Initialize Timer 1
+ * Returns '0' if the interrupt is requested but its vector is compiled out
+ */
+uint8_t init_timer1(uint8_t waveform_mode, uint16_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)())
 {
 	// Set Timer 1 Waveform Mode
 	set_timer1_waveform(waveform_mode);
@@ -168,12 +221,15 @@ void init_timer1(uint8_t waveform_mode, uint16_t msec, uint8_t compare_mode, uin
 	// Configure Interrupt Mode if Enabled
 	if(interrupt)
 	{
-		set_timer1_interrupt(waveform_mode); // The interrupt has to match the Waveform Mode
-		gp_timer1_func = f;				  // Copy f to gp_timer1_func
+		// The interrupt has to match the Waveform Mode, the timer is not
+		// started if its vector is compiled out
+		if(!set_timer1_interrupt(waveform_mode, f))
+			return 0;
 	}
 		
 	// Set Prescaler
 	set_timer1_prescaler(prescaler);
+	return 1;
 }
 
 // Returns TC1 Counter Value
@@ -210,37 +266,14 @@ void stop_timer1()
 /* Watch for an Overflow Event - No interruptions enabled */
 uint8_t check_timer1_overflow()
 {
-	uint8_t b_overflow;
+	uint8_t b_overflow = 0;
 	// (TIFR1): TC1 Interrupt Flag Register
 	// (TOV1): Timer/Counter 1, Overflow Flag
-	if((TIFR1 & (1 << TOV1)))	// Wait until occurs the overflow
-		b_overflow = 1;	
-	b_overflow = 0;
+	if((TIFR1 & (1 << TOV1)))	// Overflow occurred
+		b_overflow = 1;
 	return b_overflow;
 }
 
-/* Timer 1 Interrupts, enable the desired Interrupt on the TIMER.h file */
-#ifdef TIMER1_INTERRUPT_OCIEA
-ISR(TIMER1_COMPA_vect)
-{
-	gp_timer1_func();
-}
-#endif
-
-#ifdef TIMER1_INTERRUPT_TOEI
-ISR(TIMER1_OVF_vect)
-{
-	gp_timer1_func();
-}
-#endif
-
-#ifdef TIMER1_INTERRUPT_ICIE
-ISR(TIMER1_CAPT_vect)
-{
-	gp_timer1_func();
-}
-#endif
-
 /*
  * //////////////////////////////////////////////////////////////////////////
  *						Timer/Counter 0 Functions
@@ -339,46 +372,60 @@ static inline void set_timer0_ticks(uint16_t prescaler, uint8_t msec)
 			break;
 	}
 
-	uint8_t ticks;
-	ticks = (uint8_t) (((F_CPU) / (prescaler) * (msec) / (1000)) - 1);
-	OCR0A |= ticks;
+	// Saturate instead of wrapping when the period does not fit the prescaler
+	// See TIMER_SOLVER.h to size the timer at compile time instead
+	uint32_t ticks = (uint32_t) ((F_CPU) / 1000UL) * msec / prescaler;
+	if(ticks > 0x100)
+		ticks = 0x100;
+	if(!ticks)
+		ticks = 1;
+	OCR0A = (uint8_t) (ticks - 1);
 }
 
 /* 
  * Timer 0 Interrupt Enable
- * Sets the Interrupt corresponded to the Waveform Configuration 
+ * Attaches f to the Interrupt corresponded to the Waveform Configuration 
  */
-static inline void set_timer0_interrupt(uint8_t interrupt)
+static inline uint8_t set_timer0_interrupt(uint8_t interrupt, void (*f)())
 {
 	/* 
 	 * Timer 0 Waveform Generation Mode 
 	 * '0': Normal
 	 * '1': CTC (Clear Timer on Compare Match) -> TOP: OCR0A 
 	 */
+	uint8_t vector;
 	switch(interrupt)
 	{
-		// (TIMSK0): Timer/Counter 0 Interrupt Mask Register
-		// (TOIE0): Overflow Interrupt Enable
+		// (TOIE0): Overflow Interrupt
 		case WAVEFORM_NORMAL: 
-			TIMSK0 |= (1 << TOIE0);
+			vector = TIMER0_OVF;
 			break;
 			
-		// (OCIE0A): Output Compare A Match Interrupt Enable
+		// (OCIE0A): Output Compare A Match Interrupt
 		case WAVEFORM_CTC_OCR0A:
-			TIMSK0 |= (1 << OCIE0A);
+			vector = TIMER0_COMPA;
 			break;
 
 		// Default
 		default:
-			TIMSK0 |= (1 << TOIE0);
+			vector = TIMER0_OVF;
 			break;
 	}
 
-	sei();
+	// Refused if the vector is compiled out (TIMER0_xxx_DISPATCH)
+	gp_timer0_func = f;
+	if(!timer_attach(vector, timer_legacy_callback, &gp_timer0_func))
+		return 0;
+
+	critical_sei();
+	return 1;
 }
 
-/* Initialize Timer 0 */
-void init_timer0(uint8_t waveform_mode, uint8_t msec, uint8_t compareMode, uint16_t prescaler, uint8_t interrupt, void (*f)())
+/* 
+ * Initialize Timer 0
+ * Returns '0' if the interrupt is requested but its vector is compiled out
+ */
+uint8_t init_timer0(uint8_t waveform_mode, uint8_t msec, uint8_t compareMode, uint16_t prescaler, uint8_t interrupt, void (*f)())
 {
 	// Set Timer 0 Waveform Mode
 	set_timer0_waveform(waveform_mode);
@@ -393,12 +440,15 @@ void init_timer0(uint8_t waveform_mode, uint8_t msec, uint8_t compareMode, uint1
 	// Configure Interrupt Mode if Enabled
 	if(interrupt)
 	{
-		set_timer0_interrupt(waveform_mode);	// The interrupt has to match the Waveform Mode
-		gp_timer0_func = f;	// Copy f to gp_timer0_func
+		// The interrupt has to match the Waveform Mode, the timer is not
+		// started if its vector is compiled out
+		if(!set_timer0_interrupt(waveform_mode, f))
+			return 0;
 	}
 		
 	// Set Prescaler
 	set_timer0_prescaler(prescaler);
+	return 1;
 }
 
 /* Returns TC0 Counter Value */
@@ -424,7 +474,7 @@ void reset_timer0()
 }
 
 /* Disable Timer/Counter 0 */
-void stopTimer0()
+void stop_timer0()
 {
 	// Stop Timer/Counter by Setting 'No clock source' for Waveform
 	// (TCCR0B): TC0 Control Register 0 B
@@ -435,31 +485,14 @@ void stopTimer0()
 /* Watch for an Overflow Event - No interruptions enabled */
 uint8_t check_timer0_overflow()
 {
-	uint8_t b_overflow;
+	uint8_t b_overflow = 0;
 	// (TIFR0): TC0 Interrupt Flag Register
 	// (TOV0): Timer/Counter 0, Overflow Flag
-	// Wait until occurs the overflow
-	if((TIFR0 & (1 << TOV0)))
-		b_overflow = 1;	
-	b_overflow = 0;
+	if((TIFR0 & (1 << TOV0)))	// Overflow occurred
+		b_overflow = 1;
 	return b_overflow;
 }
 
-/* Timer 0 Interrupts, enable the desired Interrupt on the TIMER.h file */
-#ifdef TIMER0_INTERRUPT_OCIEA
-ISR(TIMER0_COMPA_vect)
-{
-	gp_timer0_func();
-}
-#endif
-
-#ifdef TIMER0_INTERRUPT_TOEI
-ISR(TIMER0_OVF_vect)
-{
-	gp_timer0_func();
-}
-#endif
-
 /*
  * //////////////////////////////////////////////////////////////////////////
  *						Timer/Counter 2 Functions
@@ -471,9 +504,11 @@ ISR(TIMER0_OVF_vect)
  * '0': No clock source (Timer/Counter stopped)
  * '1': clk/1 (No prescaling)
  * '2': clk/8 (From prescaler)
- * '3': clk/64 (From prescaler)
- * '4': clk/256 (From prescaler)
- * '5': clk/1024 (From prescaler)
+ * '3': clk/32 (From prescaler)
+ * '4': clk/64 (From prescaler)
+ * '5': clk/128 (From prescaler)
+ * '6': clk/256 (From prescaler)
+ * '7': clk/1024 (From prescaler)
  */
 static inline void set_timer2_prescaler(uint16_t prescaler)
 {
@@ -541,10 +576,18 @@ static inline void set_timer2_ticks(uint16_t prescaler, uint8_t msec)
 			prescaler = 8;
 			break;
 
+		case TIMER2_PRESCALER_32:
+			prescaler = 32;
+			break;
+
 		case TIMER2_PRESCALER_64:
 			prescaler = 64;
 			break;
 
+		case TIMER2_PRESCALER_128:
+			prescaler = 128;
+			break;
+
 		case TIMER2_PRESCALER_256:
 			prescaler = 256;
 			break;
@@ -558,40 +601,55 @@ static inline void set_timer2_ticks(uint16_t prescaler, uint8_t msec)
 			break;
 	}
 
-	uint8_t ticks;
-	ticks = (uint8_t) (((F_CPU) / (prescaler) * (msec) / (1000)) - 1);
-	OCR2A |= ticks;
+	// Saturate instead of wrapping when the period does not fit the prescaler
+	// See TIMER_SOLVER.h to size the timer at compile time instead
+	uint32_t ticks = (uint32_t) ((F_CPU) / 1000UL) * msec / prescaler;
+	if(ticks > 0x100)
+		ticks = 0x100;
+	if(!ticks)
+		ticks = 1;
+	OCR2A = (uint8_t) (ticks - 1);
 }
 
 /*
  *  Timer 2 Interrupt Enable
- * Sets the Interrupt corresponded to the Waveform Configuration 
+ * Attaches f to the Interrupt corresponded to the Waveform Configuration 
  */
-static inline void set_timer2_interrupt(uint8_t interrupt)
+static inline uint8_t set_timer2_interrupt(uint8_t interrupt, void (*f)())
 {
 	/* 
 	 * Timer 2 Waveform Generation Mode 
 	 * '0': Normal
 	 * '1': CTC (Clear Timer on Compare Match) -> TOP: OCR2A 
 	 */
+	uint8_t vector;
 	switch(interrupt)
 	{
-		// (TIMSK2): Timer/Counter 2 Interrupt Mask Register
-		// (TOIE2): Overflow Interrupt Enable
-		case WAVEFORM_NORMAL: 
-			TIMSK2 |= (1 << TOIE2);
-			break;
-			
-		// (OCIE2A): Output Compare A Match Interrupt Enable
+		// (OCIE2A): Output Compare A Match Interrupt
 		case WAVEFORM_CTC_OCR2A:
-			TIMSK2 |= (1 << OCIE2A);
+			vector = TIMER2_COMPA;
+			break;
+
+		// (TOIE2): Overflow Interrupt
+		default:
+			vector = TIMER2_OVF;
 			break;
 	}
 
-	sei();
+	// Refused if the vector is compiled out (TIMER2_xxx_DISPATCH)
+	gp_timer2_func = f;
+	if(!timer_attach(vector, timer_legacy_callback, &gp_timer2_func))
+		return 0;
+
+	critical_sei();
+	return 1;
 }
 
-void init_timer2(uint8_t waveform_mode, uint8_t msec, uint8_t compareMode, uint16_t prescaler, uint8_t interrupt, void (*f)())
+/* 
+ * Initialize Timer 2
+ * Returns '0' if the interrupt is requested but its vector is compiled out
+ */
+uint8_t init_timer2(uint8_t waveform_mode, uint8_t msec, uint8_t compareMode, uint16_t prescaler, uint8_t interrupt, void (*f)())
 {
 	// Set Timer 2 Waveform Mode
 	set_timer2_waveform(waveform_mode);
@@ -606,12 +664,15 @@ void init_timer2(uint8_t waveform_mode, uint8_t msec, uint8_t compareMode, uint1
 	// Configure Interrupt Mode if Enabled
 	if(interrupt)
 	{
-		set_timer2_interrupt(waveform_mode);	// The interrupt has to match the Waveform Mode
-		gp_timer2_func = f;	// Copy f to gp_timer2_func
+		// The interrupt has to match the Waveform Mode, the timer is not
+		// started if its vector is compiled out
+		if(!set_timer2_interrupt(waveform_mode, f))
+			return 0;
 	}
 		
 	// Set Prescaler
 	set_timer2_prescaler(prescaler);
+	return 1;
 }
 
 /* Returns TC2 Counter Value */
@@ -648,27 +709,514 @@ void stop_timer2()
 /* Watch for an Overflow Event - No interruptions enabled */
 uint8_t check_timer2_overflow()
 {
-	uint8_t b_overflow;
+	uint8_t b_overflow = 0;
 	// (TIFR2): TC2 Interrupt Flag Register
 	// (TOV2): Timer/Counter 2, Overflow Flag
-	// Wait until occurs the overflow
-	if((TIFR2 & (1 << TOV2)))
-		b_overflow =  1;	
-	b_overflow = 0;
+	if((TIFR2 & (1 << TOV2)))	// Overflow occurred
+		b_overflow = 1;
 	return b_overflow;
 }
 
-/* Timer 2 Interrupts, enable the desired Interrupt on the TIMER.h file */
-#ifdef TIMER2_INTERRUPT_OCIEA
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter PWM Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Initialize Timer 0 PWM, TOP: 0xFF
+ * Fast PWM: f = F_CPU / (N * 256)
+ * Phase Correct PWM: f = F_CPU / (N * 510)
+ * Channel A drives OC0A (PD6), Channel B drives OC0B (PD5)
+ */
+void init_pwm_timer0(uint8_t pwm_mode, uint8_t channels, uint8_t output, uint16_t prescaler)
+{
+	// Stop Timer 0 while it is configured
+	stop_timer0();
+
+	// (TCCR0A): TC0 Control Register A
+	// (WGM0n): Waveform Generation Mode, '11': Fast PWM, '01': Phase Correct PWM
+	uint8_t tccr0a = (pwm_mode == PWM_MODE_PHASE_CORRECT) ? (1 << WGM00) : ((1 << WGM01) | (1 << WGM00));
+	
+	// (COM0xn): Compare Output Mode for Channel
+	if(channels & PWM_CHANNEL_A)
+	{
+		tccr0a |= (output << COM0A0);
+		DDRD |= (1 << PD6);
+	}
+	
+	if(channels & PWM_CHANNEL_B)
+	{
+		tccr0a |= (output << COM0B0);
+		DDRD |= (1 << PD5);
+	}
+
+	OCR0A = 0;
+	OCR0B = 0;
+	TCNT0 = 0;
+	TCCR0A = tccr0a;
+
+	// (TCCR0B): TC0 Control Register B, WGM02 = 0
+	TCCR0B = (prescaler << CS00);
+}
+
+/* 
+ * Set Timer 0 Duty Cycle, 0 - 255
+ * OCR0x is double buffered in PWM modes, the new duty cycle
+ * takes effect at the end of the current period without glitches
+ */
+void set_pwm_timer0_duty(uint8_t channel, uint8_t duty)
+{
+	// (OCR0x): TC0 Output Compare Register
+	if(channel == PWM_CHANNEL_B)
+		OCR0B = duty;
+	else
+		OCR0A = duty;
+}
+
+/* Timer 1 Clock Select to Prescaler Divider */
+static const uint16_t g_timer1_dividers[] = { 1, 8, 64, 256, 1024 };
+
+/* 
+ * Timer 1 TOP (ICR1), glitch-free for any value
+ * ICR1 is not double buffered, so the counter is restarted
+ * when it is already past the new TOP
+ */
+static inline void set_pwm_timer1_top(uint16_t top)
+{
+	// (ICR1): TC1 Input Capture Register, TOP in PWM modes 10 and 14
+	CRITICAL_BLOCK()
+	{
+		ICR1 = top;
+		if(TCNT1 > top)
+			TCNT1 = 0;
+	}
+}
+
+/* 
+ * Initialize Timer 1 PWM, TOP: ICR1
+ * Fast PWM (Mode 14): f = F_CPU / (N * (1 + TOP))
+ * Phase Correct PWM (Mode 10): f = F_CPU / (2 * N * TOP)
+ * Channel A drives OC1A (PB1), Channel B drives OC1B (PB2)
+ */
+void init_pwm_timer1(uint8_t pwm_mode, uint16_t top, uint8_t channels, uint8_t output, uint16_t prescaler)
+{
+	// Stop Timer 1 while it is configured
+	stop_timer1();
+	
+	// (TCCR1A): TC1 Control Register A
+	// (TCCR1B): TC1 Control Register B
+	// (WGM1n): Waveform Generation Mode, '1110': Fast PWM, '1010': Phase Correct PWM
+	uint8_t tccr1a = (1 << WGM11);
+	uint8_t tccr1b = (1 << WGM13);
+	if(pwm_mode != PWM_MODE_PHASE_CORRECT)
+		tccr1b |= (1 << WGM12);
+
+	// (COM1xn): Compare Output Mode for Channel
+	if(channels & PWM_CHANNEL_A)
+	{
+		tccr1a |= (output << COM1A0);
+		DDRB |= (1 << PB1);
+	}
+
+	if(channels & PWM_CHANNEL_B)
+	{
+		tccr1a |= (output << COM1B0);
+		DDRB |= (1 << PB2);
+	}
+
+	// 16-bit registers share the TEMP register, write them atomically
+	CRITICAL_BLOCK()
+	{
+		ICR1 = top;
+		OCR1A = 0;
+		OCR1B = 0;
+		TCNT1 = 0;
+	}
+	
+	TCCR1A = tccr1a;
+	TCCR1B = tccr1b | (prescaler << CS10);
+}
+
+/* Set Timer 1 Resolution, 8 - 16 bits (TOP = 2^bits - 1) */
+void set_pwm_timer1_resolution(uint8_t bits)
+{
+	if(bits < 8)
+		bits = 8;
+	if(bits > 16)
+		bits = 16;
+	
+	set_pwm_timer1_top((uint16_t) ((1UL << bits) - 1));
+}
+
+/* 
+ * Set Timer 1 Frequency in Hz
+ * Picks the smallest prescaler that fits, which gives the highest resolution
+ * Returns '0' if the frequency cannot be generated
+ */
+uint8_t set_pwm_timer1_frequency(uint32_t frequency)
+{
+	if(!frequency)
+		return 0;
+
+	// Phase Correct PWM counts up and down, halving the frequency
+	uint8_t phase_correct = !(TCCR1B & (1 << WGM12));
+
+	for(uint8_t i = 0; i < sizeof(g_timer1_dividers) / sizeof(g_timer1_dividers[0]); i++)
+	{
+		uint32_t counts = (F_CPU) / ((uint32_t) g_timer1_dividers[i] * frequency);
+
+		// Below a TOP of 2 there is no room for a duty cycle
+		if(counts < 4)
+			return 0;
+
+		if(phase_correct)
+			counts /= 2;
+		else
+			counts -= 1;
+
+		if(counts <= 0xFFFF)
+		{
+			set_pwm_timer1_top((uint16_t) counts);
+			
+			// (CS1n): Clock Select 1 [n = 0:2]
+			TCCR1B = (TCCR1B & ~((1 << CS12) | (1 << CS11) | (1 << CS10))) | ((i + 1) << CS10);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/* Returns Timer 1 TOP, the full scale of the duty cycle */
+uint16_t value_pwm_timer1_top()
+{
+	uint16_t top;
+	CRITICAL_BLOCK()
+	{
+		top = ICR1;
+	}
+	return top;
+}
+
+/* 
+ * Set Timer 1 Duty Cycle, 0 - TOP
+ * OCR1x is double buffered in PWM modes, the new duty cycle
+ * takes effect at the end of the current period without glitches
+ */
+void set_pwm_timer1_duty(uint8_t channel, uint16_t duty)
+{
+	// (OCR1x): TC1 Output Compare Register
+	CRITICAL_BLOCK()
+	{
+		if(channel == PWM_CHANNEL_B)
+			OCR1B = duty;
+		else
+			OCR1A = duty;
+	}
+}
+
+/* 
+ * Initialize Timer 2 PWM, TOP: 0xFF
+ * Fast PWM: f = F_CPU / (N * 256)
+ * Phase Correct PWM: f = F_CPU / (N * 510)
+ * Channel A drives OC2A (PB3), Channel B drives OC2B (PD3)
+ */
+void init_pwm_timer2(uint8_t pwm_mode, uint8_t channels, uint8_t output, uint16_t prescaler)
+{
+	// Stop Timer 2 while it is configured
+	stop_timer2();
+
+	// (TCCR2A): TC2 Control Register A
+	// (WGM2n): Waveform Generation Mode, '11': Fast PWM, '01': Phase Correct PWM
+	uint8_t tccr2a = (pwm_mode == PWM_MODE_PHASE_CORRECT) ? (1 << WGM20) : ((1 << WGM21) | (1 << WGM20));
+
+	// (COM2xn): Compare Output Mode for Channel
+	if(channels & PWM_CHANNEL_A)
+	{
+		tccr2a |= (output << COM2A0);
+		DDRB |= (1 << PB3);
+	}
+
+	if(channels & PWM_CHANNEL_B)
+	{
+		tccr2a |= (output << COM2B0);
+		DDRD |= (1 << PD3);
+	}
+
+	OCR2A = 0;
+	OCR2B = 0;
+	TCNT2 = 0;
+	TCCR2A = tccr2a;
+
+	// (TCCR2B): TC2 Control Register B, WGM22 = 0
+	TCCR2B = (prescaler << CS20);
+}
+
+/* 
+ * Set Timer 2 Duty Cycle, 0 - 255
+ * OCR2x is double buffered in PWM modes, the new duty cycle
+ * takes effect at the end of the current period without glitches
+ */
+void set_pwm_timer2_duty(uint8_t channel, uint8_t duty)
+{
+	// (OCR2x): TC2 Output Compare Register
+	if(channel == PWM_CHANNEL_B)
+		OCR2B = duty;
+	else
+		OCR2A = duty;
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter Vector Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+
+/* 
+ * Interrupt Mask Register and Bit of a Vector
+ * The flag in (TIFRn) sits on the same bit as its enable in (TIMSKn)
+ */
+static volatile uint8_t *timer_vector_mask(uint8_t vector, volatile uint8_t **tifr, uint8_t *bit)
+{
+	switch(vector)
+	{
+		// (TIMSK0): Timer/Counter 0 Interrupt Mask Register
+		case TIMER0_COMPA: *tifr = &TIFR0; *bit = (1 << OCIE0A); return &TIMSK0;
+		case TIMER0_COMPB: *tifr = &TIFR0; *bit = (1 << OCIE0B); return &TIMSK0;
+		case TIMER0_OVF: *tifr = &TIFR0; *bit = (1 << TOIE0); return &TIMSK0;
+
+		// (TIMSK1): Timer/Counter 1 Interrupt Mask Register
+		case TIMER1_COMPA: *tifr = &TIFR1; *bit = (1 << OCIE1A); return &TIMSK1;
+		case TIMER1_COMPB: *tifr = &TIFR1; *bit = (1 << OCIE1B); return &TIMSK1;
+		case TIMER1_OVF: *tifr = &TIFR1; *bit = (1 << TOIE1); return &TIMSK1;
+		case TIMER1_CAPT: *tifr = &TIFR1; *bit = (1 << ICIE1); return &TIMSK1;
+
+		// (TIMSK2): Timer/Counter 2 Interrupt Mask Register
+		case TIMER2_COMPA: *tifr = &TIFR2; *bit = (1 << OCIE2A); return &TIMSK2;
+		case TIMER2_COMPB: *tifr = &TIFR2; *bit = (1 << OCIE2B); return &TIMSK2;
+		default: *tifr = &TIFR2; *bit = (1 << TOIE2); return &TIMSK2;
+	}
+}
+
+/* 
+ * Attach a Callback to a Timer Vector and Enable its Interrupt
+ * Returns '0' if the vector is compiled out (TIMERn_xxx_DISPATCH)
+ */
+uint8_t timer_attach(uint8_t vector, timer_callback_t callback, void *ctx)
+{
+	if(vector >= TIMER_VECTOR_COUNT || !callback || !g_timer_dispatch[vector])
+		return 0;
+
+	volatile uint8_t *tifr;
+	uint8_t bit;
+	volatile uint8_t *timsk = timer_vector_mask(vector, &tifr, &bit);
+	
+	CRITICAL_BLOCK()
+	{
+		g_timer_vectors[vector].callback = callback;
+		g_timer_vectors[vector].ctx = ctx;
+		
+		// Clear a stale flag (Writing a logic one to the flag clears it)
+		*tifr = bit;
+		*timsk |= bit;
+	}
+	return 1;
+}
+
+/* Disable a Timer Vector Interrupt and Detach its Callback */
+void timer_detach(uint8_t vector)
+{
+	if(vector >= TIMER_VECTOR_COUNT)
+		return;
+
+	volatile uint8_t *tifr;
+	uint8_t bit;
+	volatile uint8_t *timsk = timer_vector_mask(vector, &tifr, &bit);
+
+	CRITICAL_BLOCK()
+	{
+		*timsk &= ~bit;
+		g_timer_vectors[vector].callback = 0;
+		g_timer_vectors[vector].ctx = 0;
+	}
+}
+
+#if CRITICAL_INSTRUMENT
+// log2 of the clock divider selected by (CSn2:0), external clocks count as clk/1
+static const uint8_t g_timer01_cs_shift[8] = { 0, 0, 3, 6, 8, 10, 0, 0 };
+static const uint8_t g_timer2_cs_shift[8] = { 0, 0, 3, 5, 6, 7, 8, 10 };
+
+// Hardware vector number of each timer vector
+static const uint8_t g_timer_vect_num[TIMER_VECTOR_COUNT] =
+{
+	TIMER0_COMPA_vect_num, TIMER0_COMPB_vect_num, TIMER0_OVF_vect_num,
+	TIMER1_COMPA_vect_num, TIMER1_COMPB_vect_num, TIMER1_OVF_vect_num, TIMER1_CAPT_vect_num,
+	TIMER2_COMPA_vect_num, TIMER2_COMPB_vect_num, TIMER2_OVF_vect_num
+};
+
+/* 
+ * Entry Latency of a Vector in CPU Cycles
+ * The ticks counted since the event (counter minus the matched value,
+ * across TOP if it wrapped) scaled by the prescaler
+ */
+static inline uint16_t timer_latency(uint8_t vector)
+{
+	uint16_t count, event, top;
+	uint8_t shift;
+
+	switch(vector)
+	{
+		case TIMER0_COMPA:
+		case TIMER0_COMPB:
+		case TIMER0_OVF:
+			count = TCNT0;
+			event = (vector == TIMER0_COMPA) ? OCR0A : (vector == TIMER0_COMPB) ? OCR0B : 0;
+			top = (TCCR0A & (1 << WGM01)) && !(TCCR0A & (1 << WGM00)) ? OCR0A : 0xFF;
+			shift = g_timer01_cs_shift[TCCR0B & 0x07];
+			break;
+
+		case TIMER2_COMPA:
+		case TIMER2_COMPB:
+		case TIMER2_OVF:
+			count = TCNT2;
+			event = (vector == TIMER2_COMPA) ? OCR2A : (vector == TIMER2_COMPB) ? OCR2B : 0;
+			top = (TCCR2A & (1 << WGM21)) && !(TCCR2A & (1 << WGM20)) ? OCR2A : 0xFF;
+			shift = g_timer2_cs_shift[TCCR2B & 0x07];
+			break;
+
+		default:
+		{
+			count = TCNT1;
+			event = (vector == TIMER1_COMPA) ? OCR1A : (vector == TIMER1_COMPB) ? OCR1B : (vector == TIMER1_CAPT) ? ICR1 : 0;
+
+			// (WGM13:0) 4, 9, 11, 15: TOP = OCR1A, 8, 10, 12, 14: TOP = ICR1
+			uint8_t wgm = ((TCCR1B >> (WGM12 - 2)) & 0x0C) | (TCCR1A & 0x03);
+			if(wgm == 4 || wgm == 9 || wgm == 11 || wgm == 15)
+				top = OCR1A;
+			else if(wgm >= 8 && !(wgm & 1))
+				top = ICR1;
+			else
+				top = 0xFFFF;
+			shift = g_timer01_cs_shift[TCCR1B & 0x07];
+			break;
+		}
+	}
+
+	uint16_t ticks = (count >= event) ? count - event : count + (top - event) + 1;
+	return ticks << shift;
+}
+
+#define TIMER_LATENCY(vector) critical_isr_latency(g_timer_vect_num[vector], timer_latency(vector))
+#else
+#define TIMER_LATENCY(vector) ((void) 0)
+#endif
+
+#if TIMER_DISPATCH_DEFERRED_ANY
+/* Runs a Deferred Vector's Callback from event_dispatch(), arg is the vector */
+static void timer_deferred(uint8_t vector, void *ctx)
+{
+	timer_callback_t callback;
+
+	CRITICAL_BLOCK()
+	{
+		callback = g_timer_vectors[vector].callback;
+		ctx = g_timer_vectors[vector].ctx;
+	}
+
+	// Detached while the event was queued
+	if(callback)
+		callback(ctx);
+}
+#endif
+
+/* 
+ * Timer Interrupts, compiled in with TIMERn_xxx_DISPATCH
+ * The interrupt is only enabled while a callback is attached
+ * Direct: The callback runs here, Deferred: Only an event is queued
+ */
+#define TIMER_DISPATCH(vector, mode) TIMER_DISPATCH_MODE(vector, mode)
+#define TIMER_DISPATCH_MODE(vector, mode) TIMER_DISPATCH_##mode(vector)
+
+#define TIMER_DISPATCH_1(vector) \
+	do \
+	{ \
+		TIMER_LATENCY(vector); \
+		g_timer_vectors[vector].callback(g_timer_vectors[vector].ctx); \
+	} while(0)
+
+#define TIMER_DISPATCH_2(vector) \
+	do \
+	{ \
+		TIMER_LATENCY(vector); \
+		event_post(timer_deferred, vector, 0); \
+	} while(0)
+
+#if TIMER0_COMPA_DISPATCH
+ISR(TIMER0_COMPA_vect)
+{
+	TIMER_DISPATCH(TIMER0_COMPA, TIMER0_COMPA_DISPATCH);
+}
+#endif
+
+#if TIMER0_COMPB_DISPATCH
+ISR(TIMER0_COMPB_vect)
+{
+	TIMER_DISPATCH(TIMER0_COMPB, TIMER0_COMPB_DISPATCH);
+}
+#endif
+
+#if TIMER0_OVF_DISPATCH
+ISR(TIMER0_OVF_vect)
+{
+	TIMER_DISPATCH(TIMER0_OVF, TIMER0_OVF_DISPATCH);
+}
+#endif
+
+#if TIMER1_COMPA_DISPATCH
+ISR(TIMER1_COMPA_vect)
+{
+	TIMER_DISPATCH(TIMER1_COMPA, TIMER1_COMPA_DISPATCH);
+}
+#endif
+
+#if TIMER1_COMPB_DISPATCH
+ISR(TIMER1_COMPB_vect)
+{
+	TIMER_DISPATCH(TIMER1_COMPB, TIMER1_COMPB_DISPATCH);
+}
+#endif
+
+#if TIMER1_OVF_DISPATCH
+ISR(TIMER1_OVF_vect)
+{
+	TIMER_DISPATCH(TIMER1_OVF, TIMER1_OVF_DISPATCH);
+}
+#endif
+
+#if TIMER1_CAPT_DISPATCH
+ISR(TIMER1_CAPT_vect)
+{
+	TIMER_DISPATCH(TIMER1_CAPT, TIMER1_CAPT_DISPATCH);
+}
+#endif
+
+#if TIMER2_COMPA_DISPATCH
 ISR(TIMER2_COMPA_vect)
 {
-	gp_timer2_func();
+	TIMER_DISPATCH(TIMER2_COMPA, TIMER2_COMPA_DISPATCH);
+}
+#endif
+
+#if TIMER2_COMPB_DISPATCH
+ISR(TIMER2_COMPB_vect)
+{
+	TIMER_DISPATCH(TIMER2_COMPB, TIMER2_COMPB_DISPATCH);
 }
 #endif
 
-#ifdef TIMER2_INTERRUPT_TOEI
+#if TIMER2_OVF_DISPATCH
 ISR(TIMER2_OVF_vect)
 {
-	gp_timer2_func();
+	TIMER_DISPATCH(TIMER2_OVF, TIMER2_OVF_DISPATCH);
 }
-#endif
\ No newline at end of file
+#endif
@@ -18,6 +18,8 @@ extern "C" {
 
 #include <avr/io.h>
 #include <util/delay.h>
+#include "Critical.h"
+#include "Event.h"
 #include <avr/interrupt.h>
 
 /*
@@ -41,10 +43,6 @@ extern "C" {
 #define COMPARE_CLEAR 2
 #define COMPARE_SET 3
 
-#define TIMER1_INTERRUPT_ICIE 0
-#define TIMER1_INTERRUPT_OCIEA 1
-#define TIMER1_INTERRUPT_TOEI 0
-
 /*
  * //////////////////////////////////////////////////////////////////////////
  *						Timer/Counter 0 Definitions
@@ -66,9 +64,6 @@ extern "C" {
 #define COMPARE_CLEAR 2
 #define COMPARE_SET 3
 
-#define TIMER0_INTERRUPT_OCIEA 1
-#define TIMER0_INTERRUPT_TOEI 0
-
 /*
  * //////////////////////////////////////////////////////////////////////////
  *						Timer/Counter 2 Definitions
@@ -77,9 +72,11 @@ extern "C" {
 #define TIMER2_PRESCALER_NONE 0
 #define TIMER2_PRESCALER_1 1
 #define TIMER2_PRESCALER_8 2
-#define TIMER2_PRESCALER_64 3
-#define TIMER2_PRESCALER_256 4
-#define TIMER2_PRESCALER_1024 5
+#define TIMER2_PRESCALER_32 3
+#define TIMER2_PRESCALER_64 4
+#define TIMER2_PRESCALER_128 5
+#define TIMER2_PRESCALER_256 6
+#define TIMER2_PRESCALER_1024 7
 
 #define WAVEFORM_NORMAL 0
 #define WAVEFORM_CTC_OCR2A 1
@@ -90,17 +87,97 @@ extern "C" {
 #define COMPARE_CLEAR 2
 #define COMPARE_SET 3
 
-#define TIMER2_INTERRUPT_ICIE 0
-#define TIMER2_INTERRUPT_OCIEA 1
-#define TIMER2_INTERRUPT_TOEI 0
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter Vector Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Vectors for timer_attach() and timer_detach()
+#define TIMER0_COMPA 0
+#define TIMER0_COMPB 1
+#define TIMER0_OVF 2
+#define TIMER1_COMPA 3
+#define TIMER1_COMPB 4
+#define TIMER1_OVF 5
+#define TIMER1_CAPT 6
+#define TIMER2_COMPA 7
+#define TIMER2_COMPB 8
+#define TIMER2_OVF 9
+#define TIMER_VECTOR_COUNT 10
+
+/* 
+ * Vector Dispatch, set project-wide for each vector (e.g. -DTIMER1_COMPA_DISPATCH=1)
+ * '0': Compiled out, the vector is left free for other modules (default)
+ * '1': Direct, the attached callback runs inside the ISR
+ * '2': Deferred, the ISR only queues an event and the callback runs from
+ *      event_dispatch() in the main loop (needs Event.c)
+ */
+#define TIMER_DISPATCH_NONE 0
+#define TIMER_DISPATCH_DIRECT 1
+#define TIMER_DISPATCH_DEFERRED 2
+
+#ifndef TIMER0_COMPA_DISPATCH
+#define TIMER0_COMPA_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER0_COMPB_DISPATCH
+#define TIMER0_COMPB_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER0_OVF_DISPATCH
+#define TIMER0_OVF_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER1_COMPA_DISPATCH
+#define TIMER1_COMPA_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER1_COMPB_DISPATCH
+#define TIMER1_COMPB_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER1_OVF_DISPATCH
+#define TIMER1_OVF_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER1_CAPT_DISPATCH
+#define TIMER1_CAPT_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER2_COMPA_DISPATCH
+#define TIMER2_COMPA_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER2_COMPB_DISPATCH
+#define TIMER2_COMPB_DISPATCH TIMER_DISPATCH_NONE
+#endif
+#ifndef TIMER2_OVF_DISPATCH
+#define TIMER2_OVF_DISPATCH TIMER_DISPATCH_NONE
+#endif
+
+#define TIMER_DISPATCH_DEFERRED_ANY \
+	(TIMER0_COMPA_DISPATCH == TIMER_DISPATCH_DEFERRED || TIMER0_COMPB_DISPATCH == TIMER_DISPATCH_DEFERRED || \
+	 TIMER0_OVF_DISPATCH == TIMER_DISPATCH_DEFERRED || TIMER1_COMPA_DISPATCH == TIMER_DISPATCH_DEFERRED || \
+	 TIMER1_COMPB_DISPATCH == TIMER_DISPATCH_DEFERRED || TIMER1_OVF_DISPATCH == TIMER_DISPATCH_DEFERRED || \
+	 TIMER1_CAPT_DISPATCH == TIMER_DISPATCH_DEFERRED || TIMER2_COMPA_DISPATCH == TIMER_DISPATCH_DEFERRED || \
+	 TIMER2_COMPB_DISPATCH == TIMER_DISPATCH_DEFERRED || TIMER2_OVF_DISPATCH == TIMER_DISPATCH_DEFERRED)
+
+// Callback attached to a vector, ctx is given back on every call
+typedef void (*timer_callback_t)(void *ctx);
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter PWM Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// Timer 0 PWM takes over the Millis timebase, Timer 1 PWM uses ICR1 as TOP
+#define PWM_MODE_FAST 0
+#define PWM_MODE_PHASE_CORRECT 1
+
+#define PWM_CHANNEL_A 1
+#define PWM_CHANNEL_B 2
+
+#define PWM_OUTPUT_NON_INVERTING 2 // Clear on Compare Match, Set at BOTTOM
+#define PWM_OUTPUT_INVERTING 3	   // Set on Compare Match, Clear at BOTTOM
 
 /*
  * //////////////////////////////////////////////////////////////////////////
  *						Timer/Counter 1 Functions
  * //////////////////////////////////////////////////////////////////////////
  */ 
-void (*gp_timer1_func)(); // Global Function Pointer
-void init_timer1(uint8_t waveform_mode, uint16_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)() );
+uint8_t init_timer1(uint8_t waveform_mode, uint16_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)() );
 uint16_t value_timer1();
 void clear_timer1();
 void reset_timer1();
@@ -112,8 +189,7 @@ uint8_t check_timer1_overflow();
  *						Timer/Counter 0 Functions
  * //////////////////////////////////////////////////////////////////////////
  */ 
-void (*gp_timer0_func)(); // Global Function Pointer
-void init_timer0(uint8_t waveform_mode, uint8_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)() );
+uint8_t init_timer0(uint8_t waveform_mode, uint8_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)() );
 uint8_t value_timer0();
 void clear_timer0();
 void reset_timer0();
@@ -125,14 +201,36 @@ uint8_t check_timer0_overflow();
  *						Timer/Counter 2 Functions
  * //////////////////////////////////////////////////////////////////////////
  */ 
-void (*gp_timer2_func)(); // Global Function Pointer
-void init_timer2(uint8_t waveform_mode, uint8_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)() );
+uint8_t init_timer2(uint8_t waveform_mode, uint8_t msec, uint8_t compare_mode, uint16_t prescaler, uint8_t interrupt, void (*f)() );
 uint8_t value_timer2();
 void clear_timer2();
 void reset_timer2();
 void stop_timer2();
 uint8_t check_timer2_overflow();
 
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter PWM Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+void init_pwm_timer0(uint8_t pwm_mode, uint8_t channels, uint8_t output, uint16_t prescaler);
+void set_pwm_timer0_duty(uint8_t channel, uint8_t duty);
+void init_pwm_timer1(uint8_t pwm_mode, uint16_t top, uint8_t channels, uint8_t output, uint16_t prescaler);
+void set_pwm_timer1_resolution(uint8_t bits);
+uint8_t set_pwm_timer1_frequency(uint32_t frequency);
+uint16_t value_pwm_timer1_top();
+void set_pwm_timer1_duty(uint8_t channel, uint16_t duty);
+void init_pwm_timer2(uint8_t pwm_mode, uint8_t channels, uint8_t output, uint16_t prescaler);
+void set_pwm_timer2_duty(uint8_t channel, uint8_t duty);
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter Vector Functions
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+uint8_t timer_attach(uint8_t vector, timer_callback_t callback, void *ctx);
+void timer_detach(uint8_t vector);
+
 #ifdef __cplusplus
 }
 #endif 
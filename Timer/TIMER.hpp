@@ -0,0 +1,167 @@
+/*
+ * timer.hpp
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _TIMER_HPP_
+#define _TIMER_HPP_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include "TIMER_SOLVER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter 1 Template Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Header-only C++ (-std=gnu++11) front end for Timer/Counter 1, next to
+ * the C API. Mode and period (microseconds) are template arguments;
+ * prescaler and TOP come from the compile-time solver in TIMER_SOLVER.h,
+ * so start() is a handful of constant stores and a period the timer
+ * cannot generate within TIMER_SOLVER_MAX_ERROR_PPM fails the build:
+ *	typedef Timer1<TIMER1_MODE_FAST_PWM, 20000> ServoClock;	// 50 Hz
+ *	ServoClock::start();
+ *	ServoClock::pwm<PWM_CHANNEL_A>();
+ *	ServoClock::duty<PWM_CHANNEL_A>(ServoClock::ticks_us(1500));
+ *
+ * The period interrupt (enable_period_interrupt()) is the vector named in
+ * each mode, which then belongs to the application like any other ISR.
+ */
+#define TIMER1_MODE_CTC 0			// TOP: OCR1A, period on TIMER1_COMPA_vect
+#define TIMER1_MODE_CTC_ICR1 1		// TOP: ICR1, period on TIMER1_CAPT_vect
+#define TIMER1_MODE_FAST_PWM 2		// TOP: ICR1, period on TIMER1_OVF_vect, PWM on OC1A/OC1B
+#define TIMER1_MODE_PHASE_PWM 3		// TOP: ICR1, period on TIMER1_OVF_vect, phase correct PWM
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							Timer/Counter 1 Class
+ * //////////////////////////////////////////////////////////////////////////
+ */
+template<uint8_t Mode, uint32_t Period>
+class Timer1
+{
+	static_assert(Mode <= TIMER1_MODE_PHASE_PWM, "Timer1: unknown mode");
+
+	// Phase correct counts up and down, TOP ticks is half the period
+	static constexpr uint32_t span = (Mode == TIMER1_MODE_PHASE_PWM) ? Period / 2 : Period;
+
+	static constexpr uint8_t cs = TIMER1_SOLVE_CS(US, span);
+	static constexpr uint32_t divider = TIMER1_SOLVER_DIVIDER(cs);
+	static constexpr uint32_t solved = TIMER_SOLVER_TICKS(US, span, divider);
+
+	static_assert(span > 0 && cs != TIMER1_PRESCALER_NONE, "Timer1: period does not fit any prescaler");
+	static_assert(TIMER_SOLVER_ABS(TIMER_SOLVER_ERROR_PPM(US, span, solved, divider)) <= TIMER_SOLVER_MAX_ERROR_PPM,
+		"Timer1: period error above TIMER_SOLVER_MAX_ERROR_PPM");
+	static_assert(Mode != TIMER1_MODE_PHASE_PWM || solved <= 0xFFFF, "Timer1: phase correct TOP above 0xFFFF");
+
+	// (WGM13:0): Waveform Generation Mode, split over TCCR1A and TCCR1B
+	static constexpr uint8_t wgm_a = (Mode >= TIMER1_MODE_FAST_PWM) ? (1 << WGM11) : 0;
+	static constexpr uint8_t wgm_b =
+		(Mode == TIMER1_MODE_CTC) ? (1 << WGM12) :
+		(Mode == TIMER1_MODE_PHASE_PWM) ? (1 << WGM13) : ((1 << WGM13) | (1 << WGM12));
+
+public:
+	// Counter TOP, the compare value at which a period ends
+	static constexpr uint16_t top = (uint16_t) ((Mode == TIMER1_MODE_PHASE_PWM) ? solved : solved - 1);
+
+	/* Timer ticks in a number of microseconds, for compare and duty values */
+	static constexpr uint16_t ticks_us(uint32_t us)
+	{
+		return (uint16_t) (((F_CPU) / divider * 1ULL * us + 500000ULL) / 1000000ULL);
+	}
+
+	/* Configure the Mode and TOP, clear the Counter and start it */
+	static void start()
+	{
+		// (TCCR1B): Stopped while configured
+		TCCR1B = 0;
+		TCCR1A = wgm_a;
+		TCNT1 = 0;
+
+		// (OCR1A) or (ICR1): TOP
+		if(Mode == TIMER1_MODE_CTC)
+			OCR1A = top;
+		else
+			ICR1 = top;
+
+		// (CS12:0): Clock Select from the solver
+		TCCR1B = (uint8_t) (wgm_b | (cs << CS10));
+	}
+
+	/* Stop the Clock, the mode and counter are kept */
+	static void stop()
+	{
+		TCCR1B = wgm_b;
+	}
+
+	/* Restart the Clock after stop() */
+	static void resume()
+	{
+		TCCR1B = (uint8_t) (wgm_b | (cs << CS10));
+	}
+
+	static uint16_t count()
+	{
+		return TCNT1;
+	}
+
+	static void clear()
+	{
+		TCNT1 = 0;
+	}
+
+	/* Enable the Interrupt that fires once per Period */
+	static void enable_period_interrupt()
+	{
+		// (TIMSK1): (OCIE1A) CTC, (ICIE1) CTC on ICR1, (TOIE1) PWM modes
+		TIMSK1 |= (Mode == TIMER1_MODE_CTC) ? (1 << OCIE1A) :
+			(Mode == TIMER1_MODE_CTC_ICR1) ? (1 << ICIE1) : (1 << TOIE1);
+	}
+
+	static void disable_period_interrupt()
+	{
+		TIMSK1 &= (uint8_t) ~((Mode == TIMER1_MODE_CTC) ? (1 << OCIE1A) :
+			(Mode == TIMER1_MODE_CTC_ICR1) ? (1 << ICIE1) : (1 << TOIE1));
+	}
+
+	/* Non-inverting PWM output on OC1A (PB1) or OC1B (PB2) */
+	template<uint8_t Channel>
+	static void pwm()
+	{
+		static_assert(Mode >= TIMER1_MODE_FAST_PWM, "Timer1: PWM outputs need a PWM mode");
+		static_assert(Channel == PWM_CHANNEL_A || Channel == PWM_CHANNEL_B, "Timer1: channel must be PWM_CHANNEL_A or PWM_CHANNEL_B");
+
+		// (COM1x1): Clear on Compare Match, (DDB1/DDB2): Output
+		if(Channel == PWM_CHANNEL_A)
+		{
+			TCCR1A |= (1 << COM1A1);
+			DDRB |= (1 << DDB1);
+		}
+		else
+		{
+			TCCR1A |= (1 << COM1B1);
+			DDRB |= (1 << DDB2);
+		}
+	}
+
+	/* Compare Value of a Channel (0 ... top), the duty cycle in PWM modes */
+	template<uint8_t Channel>
+	static void duty(uint16_t value)
+	{
+		static_assert(Channel == PWM_CHANNEL_A || Channel == PWM_CHANNEL_B, "Timer1: channel must be PWM_CHANNEL_A or PWM_CHANNEL_B");
+		static_assert(Mode != TIMER1_MODE_CTC || Channel == PWM_CHANNEL_B, "Timer1: OCR1A holds TOP in TIMER1_MODE_CTC");
+
+		// (OCR1A), (OCR1B): Output Compare Registers
+		if(Channel == PWM_CHANNEL_A)
+			OCR1A = value;
+		else
+			OCR1B = value;
+	}
+};
+
+#endif /* _TIMER_HPP_ */
@@ -0,0 +1,195 @@
+/*
+ * timer_solver.h
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */ 
+#pragma once
+#ifndef _TIMER_SOLVER_H_
+#define _TIMER_SOLVER_H_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include "TIMER.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer Solver Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Compile-time prescaler and TOP selection from F_CPU. Every macro expands
+ * to an integer constant expression, so no arithmetic is left for runtime.
+ * A request is given as a unit and a value:
+ *	US: Period in microseconds		e.g. TIMER1_SOLVE_TOP(US, 2500)
+ *	HZ: Frequency in hertz			e.g. TIMER2_SOLVE_CS(HZ, 1000)
+ *
+ * The smallest prescaler that fits gives the most ticks per period, which
+ * is the lowest quantization error. Requests that do not fit any prescaler,
+ * or whose error exceeds TIMER_SOLVER_MAX_ERROR_PPM, fail the build through
+ * TIMERn_SOLVE_ASSERT (also used by the TIMERn_CTC_INIT macros).
+ */ 
+
+// Largest accepted period error in parts per million, 1 % by default
+#ifndef TIMER_SOLVER_MAX_ERROR_PPM
+#define TIMER_SOLVER_MAX_ERROR_PPM 10000
+#endif
+
+// C11 and C++ spell the compile-time assertion differently
+#ifdef __cplusplus
+#define TIMER_SOLVER_STATIC_ASSERT static_assert
+#else
+#define TIMER_SOLVER_STATIC_ASSERT _Static_assert
+#endif
+
+// Ticks per period at a prescaler divider, rounded to the nearest tick
+#define TIMER_SOLVER_TICKS_US(us, div) (((F_CPU) * 1ULL * (us) + (div) * 500000ULL) / ((div) * 1000000ULL))
+#define TIMER_SOLVER_TICKS_HZ(hz, div) (((F_CPU) * 1ULL + (div) * 1ULL * (hz) / 2) / ((div) * 1ULL * (hz)))
+#define TIMER_SOLVER_TICKS(unit, value, div) TIMER_SOLVER_TICKS_##unit(value, div)
+
+// Requested and achieved periods, both in units of 1 / (F_CPU * 1000000) s
+#define TIMER_SOLVER_WANTED_US(us) ((F_CPU) * 1ULL * (us))
+#define TIMER_SOLVER_WANTED_HZ(hz) (1000000ULL * (F_CPU) / (hz))
+#define TIMER_SOLVER_WANTED(unit, value) TIMER_SOLVER_WANTED_##unit(value)
+#define TIMER_SOLVER_ACHIEVED(ticks, div) ((ticks) * 1ULL * (div) * 1000000ULL)
+
+// Signed period error in parts per million
+#define TIMER_SOLVER_ERROR_PPM(unit, value, ticks, div) \
+	((long long) ((long long) TIMER_SOLVER_ACHIEVED(ticks, div) - (long long) TIMER_SOLVER_WANTED(unit, value)) \
+	* 1000000LL / (long long) TIMER_SOLVER_WANTED(unit, value))
+
+#define TIMER_SOLVER_ABS(x) ((x) < 0 ? -(x) : (x))
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter 1 Solver (16-bit)
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define TIMER1_SOLVER_FITS(unit, value, div) \
+	(TIMER_SOLVER_TICKS(unit, value, div) >= 2 && TIMER_SOLVER_TICKS(unit, value, div) <= 0x10000)
+
+// Clock Select code (TIMER1_PRESCALER_n), TIMER1_PRESCALER_NONE if impossible
+#define TIMER1_SOLVE_CS(unit, value) \
+	(TIMER1_SOLVER_FITS(unit, value, 1) ? TIMER1_PRESCALER_1 : \
+	TIMER1_SOLVER_FITS(unit, value, 8) ? TIMER1_PRESCALER_8 : \
+	TIMER1_SOLVER_FITS(unit, value, 64) ? TIMER1_PRESCALER_64 : \
+	TIMER1_SOLVER_FITS(unit, value, 256) ? TIMER1_PRESCALER_256 : \
+	TIMER1_SOLVER_FITS(unit, value, 1024) ? TIMER1_PRESCALER_1024 : TIMER1_PRESCALER_NONE)
+
+#define TIMER1_SOLVER_DIVIDER(cs) \
+	((cs) == TIMER1_PRESCALER_1 ? 1 : (cs) == TIMER1_PRESCALER_8 ? 8 : \
+	(cs) == TIMER1_PRESCALER_64 ? 64 : (cs) == TIMER1_PRESCALER_256 ? 256 : 1024)
+
+#define TIMER1_SOLVE_DIVIDER(unit, value) TIMER1_SOLVER_DIVIDER(TIMER1_SOLVE_CS(unit, value))
+#define TIMER1_SOLVE_TICKS(unit, value) TIMER_SOLVER_TICKS(unit, value, TIMER1_SOLVE_DIVIDER(unit, value))
+
+// TOP for CTC (OCR1A) or Fast PWM (ICR1): ticks - 1
+#define TIMER1_SOLVE_TOP(unit, value) ((uint16_t) (TIMER1_SOLVE_TICKS(unit, value) - 1))
+
+#define TIMER1_SOLVE_ERROR_PPM(unit, value) \
+	TIMER_SOLVER_ERROR_PPM(unit, value, TIMER1_SOLVE_TICKS(unit, value), TIMER1_SOLVE_DIVIDER(unit, value))
+
+#define TIMER1_SOLVE_ASSERT(unit, value) \
+	TIMER_SOLVER_STATIC_ASSERT(TIMER1_SOLVE_CS(unit, value) != TIMER1_PRESCALER_NONE \
+	&& TIMER_SOLVER_ABS(TIMER1_SOLVE_ERROR_PPM(unit, value)) <= TIMER_SOLVER_MAX_ERROR_PPM, \
+	"Timer 1 cannot generate " #value " " #unit)
+
+// CTC - TOP: OCR1A, started with the solved prescaler
+#define TIMER1_CTC_INIT(unit, value) do { \
+	TIMER1_SOLVE_ASSERT(unit, value); \
+	TCCR1B = 0; \
+	TCCR1A = 0; \
+	TCNT1 = 0; \
+	OCR1A = TIMER1_SOLVE_TOP(unit, value); \
+	TCCR1B = (1 << WGM12) | (TIMER1_SOLVE_CS(unit, value) << CS10); \
+} while(0)
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter 0 Solver (8-bit)
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define TIMER0_SOLVER_FITS(unit, value, div) \
+	(TIMER_SOLVER_TICKS(unit, value, div) >= 2 && TIMER_SOLVER_TICKS(unit, value, div) <= 0x100)
+
+// Clock Select code (TIMER0_PRESCALER_n), TIMER0_PRESCALER_NONE if impossible
+#define TIMER0_SOLVE_CS(unit, value) \
+	(TIMER0_SOLVER_FITS(unit, value, 1) ? TIMER0_PRESCALER_1 : \
+	TIMER0_SOLVER_FITS(unit, value, 8) ? TIMER0_PRESCALER_8 : \
+	TIMER0_SOLVER_FITS(unit, value, 64) ? TIMER0_PRESCALER_64 : \
+	TIMER0_SOLVER_FITS(unit, value, 256) ? TIMER0_PRESCALER_256 : \
+	TIMER0_SOLVER_FITS(unit, value, 1024) ? TIMER0_PRESCALER_1024 : TIMER0_PRESCALER_NONE)
+
+#define TIMER0_SOLVER_DIVIDER(cs) \
+	((cs) == TIMER0_PRESCALER_1 ? 1 : (cs) == TIMER0_PRESCALER_8 ? 8 : \
+	(cs) == TIMER0_PRESCALER_64 ? 64 : (cs) == TIMER0_PRESCALER_256 ? 256 : 1024)
+
+#define TIMER0_SOLVE_DIVIDER(unit, value) TIMER0_SOLVER_DIVIDER(TIMER0_SOLVE_CS(unit, value))
+#define TIMER0_SOLVE_TICKS(unit, value) TIMER_SOLVER_TICKS(unit, value, TIMER0_SOLVE_DIVIDER(unit, value))
+#define TIMER0_SOLVE_TOP(unit, value) ((uint8_t) (TIMER0_SOLVE_TICKS(unit, value) - 1))
+
+#define TIMER0_SOLVE_ERROR_PPM(unit, value) \
+	TIMER_SOLVER_ERROR_PPM(unit, value, TIMER0_SOLVE_TICKS(unit, value), TIMER0_SOLVE_DIVIDER(unit, value))
+
+#define TIMER0_SOLVE_ASSERT(unit, value) \
+	TIMER_SOLVER_STATIC_ASSERT(TIMER0_SOLVE_CS(unit, value) != TIMER0_PRESCALER_NONE \
+	&& TIMER_SOLVER_ABS(TIMER0_SOLVE_ERROR_PPM(unit, value)) <= TIMER_SOLVER_MAX_ERROR_PPM, \
+	"Timer 0 cannot generate " #value " " #unit)
+
+// CTC - TOP: OCR0A, started with the solved prescaler
+#define TIMER0_CTC_INIT(unit, value) do { \
+	TIMER0_SOLVE_ASSERT(unit, value); \
+	TCCR0B = 0; \
+	TCCR0A = (1 << WGM01); \
+	TCNT0 = 0; \
+	OCR0A = TIMER0_SOLVE_TOP(unit, value); \
+	TCCR0B = (TIMER0_SOLVE_CS(unit, value) << CS00); \
+} while(0)
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *						Timer/Counter 2 Solver (8-bit)
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+#define TIMER2_SOLVER_FITS(unit, value, div) \
+	(TIMER_SOLVER_TICKS(unit, value, div) >= 2 && TIMER_SOLVER_TICKS(unit, value, div) <= 0x100)
+
+// Clock Select code (TIMER2_PRESCALER_n), TIMER2_PRESCALER_NONE if impossible
+#define TIMER2_SOLVE_CS(unit, value) \
+	(TIMER2_SOLVER_FITS(unit, value, 1) ? TIMER2_PRESCALER_1 : \
+	TIMER2_SOLVER_FITS(unit, value, 8) ? TIMER2_PRESCALER_8 : \
+	TIMER2_SOLVER_FITS(unit, value, 32) ? TIMER2_PRESCALER_32 : \
+	TIMER2_SOLVER_FITS(unit, value, 64) ? TIMER2_PRESCALER_64 : \
+	TIMER2_SOLVER_FITS(unit, value, 128) ? TIMER2_PRESCALER_128 : \
+	TIMER2_SOLVER_FITS(unit, value, 256) ? TIMER2_PRESCALER_256 : \
+	TIMER2_SOLVER_FITS(unit, value, 1024) ? TIMER2_PRESCALER_1024 : TIMER2_PRESCALER_NONE)
+
+#define TIMER2_SOLVER_DIVIDER(cs) \
+	((cs) == TIMER2_PRESCALER_1 ? 1 : (cs) == TIMER2_PRESCALER_8 ? 8 : \
+	(cs) == TIMER2_PRESCALER_32 ? 32 : (cs) == TIMER2_PRESCALER_64 ? 64 : \
+	(cs) == TIMER2_PRESCALER_128 ? 128 : (cs) == TIMER2_PRESCALER_256 ? 256 : 1024)
+
+#define TIMER2_SOLVE_DIVIDER(unit, value) TIMER2_SOLVER_DIVIDER(TIMER2_SOLVE_CS(unit, value))
+#define TIMER2_SOLVE_TICKS(unit, value) TIMER_SOLVER_TICKS(unit, value, TIMER2_SOLVE_DIVIDER(unit, value))
+#define TIMER2_SOLVE_TOP(unit, value) ((uint8_t) (TIMER2_SOLVE_TICKS(unit, value) - 1))
+
+#define TIMER2_SOLVE_ERROR_PPM(unit, value) \
+	TIMER_SOLVER_ERROR_PPM(unit, value, TIMER2_SOLVE_TICKS(unit, value), TIMER2_SOLVE_DIVIDER(unit, value))
+
+#define TIMER2_SOLVE_ASSERT(unit, value) \
+	TIMER_SOLVER_STATIC_ASSERT(TIMER2_SOLVE_CS(unit, value) != TIMER2_PRESCALER_NONE \
+	&& TIMER_SOLVER_ABS(TIMER2_SOLVE_ERROR_PPM(unit, value)) <= TIMER_SOLVER_MAX_ERROR_PPM, \
+	"Timer 2 cannot generate " #value " " #unit)
+
+// CTC - TOP: OCR2A, started with the solved prescaler
+#define TIMER2_CTC_INIT(unit, value) do { \
+	TIMER2_SOLVE_ASSERT(unit, value); \
+	TCCR2B = 0; \
+	TCCR2A = (1 << WGM21); \
+	TCNT2 = 0; \
+	OCR2A = TIMER2_SOLVE_TOP(unit, value); \
+	TCCR2B = (TIMER2_SOLVE_CS(unit, value) << CS20); \
+} while(0)
+
+#endif /* _TIMER_SOLVER_H_ */
@@ -4,7 +4,11 @@
  * Author: Miguel Osuna
  */
 
-#include "usart.h"
+#include "USART.h"
+
+#if USART_SLEEP_WAIT || USART_SLEEP_WAIT_TX
+#include "Wait.h"
+#endif
 
 /*
  * //////////////////////////////////////////////////////////////////////////
@@ -91,7 +95,13 @@ void tx_byte(uint8_t data)
 	// Wait for empty transmit buffer 
 	// (UDRE0): USART Data Register Empty 0 
 	// (UCSR0A): USART Control Status Register 0 A
+#if USART_SLEEP_WAIT_TX
+	// (UDRIE0): Data Register Empty Interrupt Enable, off again in the ISR
+	UCSR0B |= (1 << UDRIE0);
+	WAIT_UNTIL(SLEEP_MODE_IDLE, UCSR0A & (1 << UDRE0));
+#else
 	while(!(UCSR0A & (1 << UDRE0)));
+#endif
 	
 	// The data is mounted into the
 	// (UDR0): USART Data Register 0
@@ -105,7 +115,13 @@ uint8_t rx_byte()
 	/* Wait for incoming data
 	 * (UCSR0A): USART Control Status Register 0 A 
 	 * (RXC0): USART Receive Complete */
+#if USART_SLEEP_WAIT
+	// (RXCIE0): RX Complete Interrupt Enable, off again in the ISR
+	UCSR0B |= (1 << RXCIE0);
+	WAIT_UNTIL(SLEEP_MODE_IDLE, UCSR0A & (1 << RXC0));
+#else
 	while(!(UCSR0A & (1 << RXC0)));
+#endif
 	
 	/* Return value stored in Buffer */
 	return UDR0;
@@ -164,4 +180,25 @@ void print_number(uint16_t number)
 void print_line()
 {
 	put_string("\n");
-}
\ No newline at end of file
+}
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							USART Interrupts
+ * //////////////////////////////////////////////////////////////////////////
+ */ 
+// UDRE0 and RXC0 stay set until UDR0 is written or read, so each ISR
+// turns its own interrupt off and leaves the flag to the woken wait
+#if USART_SLEEP_WAIT_TX
+ISR(USART_UDRE_vect)
+{
+	UCSR0B &= ~(1 << UDRIE0);
+}
+#endif
+
+#if USART_SLEEP_WAIT
+ISR(USART_RX_vect)
+{
+	UCSR0B &= ~(1 << RXCIE0);
+}
+#endif
@@ -8,6 +8,10 @@
 #ifndef _USART_H_
 #define _USART_H_
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #ifndef F_CPU
 #define F_CPU 16000000UL
 #endif
@@ -37,6 +41,19 @@
 #define USART_BAUD_RATE_1M 1000000
 #define USART_BAUD_RATE_2M 2000000
 
+// Set USART_SLEEP_WAIT to 1 project-wide to idle-sleep in tx_byte() and
+// rx_byte() instead of polling. USART.c then owns USART_RX_vect and
+// USART_UDRE_vect, which only wake the CPU.
+#ifndef USART_SLEEP_WAIT
+#define USART_SLEEP_WAIT 0
+#endif
+
+// Log.c drains over USART_UDRE_vect itself, building with it needs
+// USART_SLEEP_WAIT_TX set to 0 (tx_byte() polls, rx_byte() still sleeps)
+#ifndef USART_SLEEP_WAIT_TX
+#define USART_SLEEP_WAIT_TX USART_SLEEP_WAIT
+#endif
+
 /*
  * //////////////////////////////////////////////////////////////////////////
  *							USART Functions
@@ -53,4 +70,8 @@ void get_string(char *str, uint8_t size);
 void print_number(uint16_t number);
 void print_line();
 
+#ifdef __cplusplus
+}
+#endif 
+
 #endif /* _USART_H_ */
\ No newline at end of file
@@ -0,0 +1,114 @@
+/*
+ * usart.hpp
+ *
+ * Created: 10/18/2026
+ * Author: Miguel Osuna
+ */
+#pragma once
+#ifndef _USART_HPP_
+#define _USART_HPP_
+
+#ifndef F_CPU
+#define F_CPU 16000000UL
+#endif
+
+#include "USART.h"
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							USART Template Definitions
+ * //////////////////////////////////////////////////////////////////////////
+ *
+ * Header-only C++ (-std=gnu++11) front end for USART0, next to the C API.
+ * UBRR0 and U2X0 are solved from F_CPU and the baud rate at compile time;
+ * init() is four constant stores and an unreachable rate fails the build:
+ *	typedef Usart<USART_BAUD_RATE_115K2> Serial;
+ *	Serial::init();
+ *	Serial::write("ready\r\n");
+ */
+// Largest accepted baud rate error in parts per million, 2.5 % by default
+// so 115200 baud at 16 MHz (2.1 % with U2X0) still builds
+#ifndef USART_MAX_ERROR_PPM
+#define USART_MAX_ERROR_PPM 25000
+#endif
+
+/*
+ * //////////////////////////////////////////////////////////////////////////
+ *							USART Class
+ * //////////////////////////////////////////////////////////////////////////
+ */
+template<uint32_t Baud>
+class Usart
+{
+	// UBRR0 for a clock divider (16 normal, 8 double speed), rounded
+	static constexpr uint32_t ubrr(uint32_t div)
+	{
+		return (F_CPU + div * Baud / 2) / (div * Baud) - 1;
+	}
+
+	// Signed baud rate error in parts per million
+	static constexpr int32_t error_ppm(uint32_t div)
+	{
+		return (int32_t) (((int64_t) F_CPU * 1000000LL / (div * (ubrr(div) + 1)) - (int64_t) Baud * 1000000LL) / (int64_t) Baud);
+	}
+
+	static constexpr bool fits(uint32_t div)
+	{
+		return (F_CPU / (div * Baud)) >= 1 && ubrr(div) <= 0x0FFF
+			&& error_ppm(div) <= USART_MAX_ERROR_PPM && error_ppm(div) >= -USART_MAX_ERROR_PPM;
+	}
+
+public:
+	// Normal speed samples each bit 16 times, U2X0 only when it is needed
+	static constexpr bool double_speed = !fits(16);
+	static constexpr uint16_t prescaler = (uint16_t) ubrr(double_speed ? 8 : 16);
+
+	static_assert(Baud > 0 && fits(double_speed ? 8 : 16), "Usart: baud rate not reachable from F_CPU within USART_MAX_ERROR_PPM");
+
+	/* 8 Data Bits, No Parity, 1 Stop Bit, Transmitter and Receiver on */
+	static void init()
+	{
+		// (UBRR0): USART Baud Rate Register 0
+		UBRR0H = (uint8_t) (prescaler >> 8);
+		UBRR0L = (uint8_t) prescaler;
+
+		// (UCSR0A): Writing '1' to U2X0 doubles the transmission speed
+		UCSR0A = double_speed ? (1 << U2X0) : 0;
+
+		// (UCSR0C): (UCSZ01:0) 8 data bits, (USBS0) 1 stop bit
+		UCSR0C = (1 << UCSZ01) | (1 << UCSZ00);
+
+		// (UCSR0B): (TXEN0) Transmitter and (RXEN0) Receiver Enable
+		UCSR0B = (1 << TXEN0) | (1 << RXEN0);
+	}
+
+	/* Transmit a Byte, waits for room in the data register */
+	static void write(uint8_t data)
+	{
+		// (UDRE0): USART Data Register Empty
+		while(!(UCSR0A & (1 << UDRE0)));
+		UDR0 = data;
+	}
+
+	static void write(const char *str)
+	{
+		while(*str)
+			write((uint8_t) *str++);
+	}
+
+	/* '1' if a received byte is waiting in UDR0 */
+	static bool available()
+	{
+		// (RXC0): USART Receive Complete
+		return (UCSR0A & (1 << RXC0)) != 0;
+	}
+
+	/* Receive a Byte, waits for one */
+	static uint8_t read()
+	{
+		while(!available());
+		return UDR0;
+	}
+};
+
+#endif /* _USART_HPP_ */